@@ -0,0 +1,1043 @@
+/******************************************************************************
+ ** Program Filename: bench.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: The benchmark program for the engines. It builds the standard
+			workloads, a random Soup and a board tiled with glider guns, and
+			times the single step sweep against the temporally blocked engine
+			at several depths, the parallel engine with NUMA placement on
+			and off, and the Larger-than-Life engine at radius 1, 5 and 10.
+			Every engine's result is checked against the sweep, Larger-than-
+			Life at radius 1 being Life, and the estimated memory traffic
+			per generation is reported so the bandwidth saved by temporal
+			blocking can be seen. Each
+			workload is also run through the multi-state Generations board,
+			as Life to check it and as Brian's Brain to time it, and recorded
+			in a History to report its compressed size and seek time,
+			shown in a Viewport to time its pyramid updates and drawing, and
+			written out in each frame format inline and through the
+			background FrameWriter to show how much output is overlapped.
+			Last, the gol library is checked through Simulation: its pattern
+			loading and rule switching, and every engine it chooses by name.
+			With --profile it instead steps each workload one pass at a
+			time under the hardware performance counters and reports IPC and
+			cache and branch misses per cell for every pass and in total, for
+			the step and for recording, viewing and writing each generation.
+ ** Input: Optional command line arguments: --profile, then rows, columns and
+		generations
+ ** Output: A table of time and memory traffic for each engine and workload, and
+		the total time of the run, or the profile
+ * ***************************************************************************/
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstdlib>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include "world.hpp"
+#include "cells.hpp"
+#include "grid.hpp"
+#include "sweep.hpp"
+#include "temporal.hpp"
+#include "parallel.hpp"
+#include "ltl.hpp"
+#include "soup.hpp"
+#include "history.hpp"
+#include "generations.hpp"
+#include "viewport.hpp"
+#include "writer.hpp"
+#include "perfcount.hpp"
+#include "simulation.hpp"
+#include "patterns.h"
+
+#define BENCH_ROWS 2048		   //Default rows on the benchmark board
+#define BENCH_COLS 2048		   //Default columns on the benchmark board
+#define BENCH_GENERATIONS 64   //Default generations stepped per run
+#define BENCH_OUTPUT_FRAMES 16 //Most generations written out per format
+#define BENCH_LTL_WIDE "R10,C0,M1,S123..212,B123..170,NM" //Widest Larger-than-Life rule timed
+
+/****************************************************************************************
+ * Function: makeGuns( Grid & )
+ * Description: Fills a grid with copies of a World array holding a glider gun
+ * Parameters: The grid to fill
+ * Pre-Conditions: None
+ * Post-Conditions: The grid is tiled with glider guns
+****************************************************************************************/
+void makeGuns( Grid & );
+
+/****************************************************************************************
+ * Function: runEngine( Engine &, const Grid &, Grid &, int, double )
+ * Description: Times an engine advancing a copy of a board and prints a table row
+ * Parameters: The engine, the starting board, the grid to hold the result, the
+ *		number of generations, and the time of the sweep to compare against (0 if
+ *		this is the sweep)
+ * Pre-Conditions: None
+ * Post-Conditions: The result holds the advanced board. returns the seconds taken
+****************************************************************************************/
+double runEngine( Engine &, const Grid &, Grid &, int, double );
+
+/****************************************************************************************
+ * Function: runHistory( const Grid &, int )
+ * Description: Records every generation of a board in a History, then rebuilds
+ *		generations with seek() and checks them against copies taken while stepping,
+ *		and a Viewport following the rebuilt board against a fresh pyramid. Prints the
+ *		compressed size, memory and disk use, and time per seek.
+ * Parameters: The starting board and the number of generations to record
+ * Pre-Conditions: None
+ * Post-Conditions: returns true if every rebuilt generation matched
+****************************************************************************************/
+bool runHistory( const Grid &, int );
+
+/****************************************************************************************
+ * Function: runGenerations( const Grid &, const char *, int, double, const Grid * )
+ * Description: Times a Generations board running a rule from a starting board and
+ *		prints a table row
+ * Parameters: The starting board, the rule, the number of generations, the time of
+ *		the sweep to compare against, and the board the sweep reached or NULL to skip
+ *		the check
+ * Pre-Conditions: None
+ * Post-Conditions: returns false if the check was made and the alive cells differ
+****************************************************************************************/
+bool runGenerations( const Grid &, const char *, int, double, const Grid * );
+
+/****************************************************************************************
+ * Function: runViewport( const Grid & )
+ * Description: Builds a Viewport's pyramid for a board, steps the board one generation
+ *		and updates the pyramid from the changed tiles, then draws the window at several
+ *		zooms. Prints the time of each. Then checks, for every engine and for a soup
+ *		fill, that the pyramid updated from the tiles marked changed matches one built
+ *		fresh at every level.
+ * Parameters: The starting board
+ * Pre-Conditions: None
+ * Post-Conditions: returns false if an updated pyramid differs from a fresh one
+****************************************************************************************/
+bool runViewport( const Grid & );
+
+/****************************************************************************************
+ * Function: samePyramid( const Viewport &, const Grid & )
+ * Description: Compares every block of every level of a Viewport's pyramid with a
+ *		pyramid built fresh from the board
+ * Parameters: The viewport, updated since the board last changed, and the board
+ * Pre-Conditions: None
+ * Post-Conditions: returns false if any block's count differs
+****************************************************************************************/
+bool samePyramid( const Viewport &, const Grid & );
+
+/****************************************************************************************
+ * Function: runOutput( const Grid &, int )
+ * Description: Steps a board and writes every generation in each frame format, once
+ *		inline and once through the background writer. Prints the time of each against
+ *		stepping alone, the writer's stalls, and checks both wrote the same files.
+ * Parameters: The starting board and the number of generations
+ * Pre-Conditions: None
+ * Post-Conditions: The files are removed. returns false if a write failed or the
+ *		files differ
+****************************************************************************************/
+bool runOutput( const Grid &, int );
+
+/****************************************************************************************
+ * Function: runLibrary( int, int, int )
+ * Description: Checks the gol library through Simulation. The menu's RLE patterns are
+ *		loaded and compared cell by cell with the Cells functions, plaintext with RLE,
+ *		and a rule in an RLE header must switch the engine. Then a soup is stepped by
+ *		every engine through Simulation and compared with a bare SweepEngine, and
+ *		view() with getCell. Prints the stepping time of each engine.
+ * Parameters: The rows and columns of the board and the number of generations
+ * Pre-Conditions: None
+ * Post-Conditions: returns false if any check failed
+****************************************************************************************/
+bool runLibrary( int, int, int );
+
+/****************************************************************************************
+ * Function: sameView( const GridView &, const Grid & )
+ * Description: Compares a view of a board with a grid word by word
+ * Parameters: The view and the grid
+ * Pre-Conditions: None
+ * Post-Conditions: returns true if the sizes and every cell match
+****************************************************************************************/
+bool sameView( const GridView &, const Grid & );
+
+/****************************************************************************************
+ * Function: runProfile( const Grid &, int )
+ * Description: Steps a board with the sweep and the temporal engine one pass at a time,
+ *		recording, viewing and writing it after each pass, with each phase under its own
+ *		performance counters. Prints every pass of the step and each phase's total.
+ * Parameters: The starting board and the number of generations
+ * Pre-Conditions: None
+ * Post-Conditions: The profile is printed
+****************************************************************************************/
+void runProfile( const Grid &, int );
+
+/****************************************************************************************
+ * Function: printNodes( ParallelEngine &, const Grid & )
+ * Description: Prints the workers, rows, local pages and busy time of each NUMA node
+ *		used by a parallel engine
+ * Parameters: The engine and the board it last advanced
+ * Pre-Conditions: The engine has advanced the board
+ * Post-Conditions: One line is printed per node with workers
+****************************************************************************************/
+void printNodes( ParallelEngine &, const Grid & );
+
+int main( int argc, char *argv[] )
+{
+	int rows = BENCH_ROWS;
+	int cols = BENCH_COLS;
+	int generations = BENCH_GENERATIONS;
+	const char *names[] = { "soup", "guns" };
+	int depths[] = { 2, 4, 8, 16 };
+	const char *ltlRules[] = { LTL_LIFE, LTL_BOSCO, BENCH_LTL_WIDE };
+	bool allMatch = true;
+
+	bool profile = argc > 1 && std::string( argv[1] ) == "--profile";
+	if( profile )
+	{
+		argc--;
+		argv++;
+	}
+
+	if( argc > 1 )
+		rows = atoi( argv[1] );
+	if( argc > 2 )
+		cols = atoi( argv[2] );
+	if( argc > 3 )
+		generations = atoi( argv[3] );
+	if( rows < 1 || cols < 1 || generations < 1 )
+	{
+		std::cout << "Usage: bench [--profile] [rows] [columns] [generations]" << std::endl;
+		return 1;
+	}
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	std::cout << "Board " << rows << " X " << cols << ", " << generations
+			  << " generations, " << (long long)rows * ((cols + 63) / 64) * 8 / 1024
+			  << " KB packed" << std::endl;
+
+	if( profile )
+	{
+		Grid start( rows, cols );
+		Soup( 1, 0.5 ).fill( start );
+		std::cout << std::endl << "Workload: soup (population " << start.population() << ")";
+		runProfile( start, generations );
+
+		start.clear();
+		makeGuns( start );
+		std::cout << std::endl << "Workload: guns (population " << start.population() << ")";
+		runProfile( start, generations );
+		return 0;
+	}
+
+	for( int w = 0; w < 2; w++ )
+	{
+		Grid start( rows, cols );
+		Grid expected;
+		Grid result;
+
+		if( w == 0 )
+		{
+			std::chrono::steady_clock::time_point fillBegin = std::chrono::steady_clock::now();
+			Soup( 1, 0.5 ).fill( start );
+			std::chrono::steady_clock::time_point fillEnd = std::chrono::steady_clock::now();
+			std::cout << std::endl << "Soup fill: " << std::fixed << std::setprecision( 4 )
+					  << std::chrono::duration<double>( fillEnd - fillBegin ).count() << " s";
+		}
+		else
+			makeGuns( start );
+
+		std::cout << std::endl << "Workload: " << names[w] << " (population "
+				  << start.population() << ")" << std::endl;
+		std::cout << std::left << std::setw( 14 ) << "engine" << std::right
+				  << std::setw( 10 ) << "seconds" << std::setw( 12 ) << "ns/cell"
+				  << std::setw( 14 ) << "KB/gen" << std::setw( 10 ) << "traffic"
+				  << std::setw( 10 ) << "speedup" << std::endl;
+
+		SweepEngine sweep;
+		double sweepTime = runEngine( sweep, start, expected, generations, 0 );
+
+		for( int d = 0; d < 4; d++ )
+		{
+			TemporalEngine temporal( depths[d] );
+			runEngine( temporal, start, result, generations, sweepTime );
+			if( !result.sameCells( expected ) )
+			{
+				std::cout << "  MISMATCH: temporal k=" << depths[d]
+						  << " differs from sweep" << std::endl;
+				allMatch = false;
+			}
+		}
+
+		//Placement off leaves the board where the main thread wrote it
+		for( int p = 1; p >= 0; p-- )
+		{
+			ParallelEngine parallel( 0, AFFINITY_COMPACT, p == 1 );
+			runEngine( parallel, start, result, generations, sweepTime );
+			if( !result.sameCells( expected ) )
+			{
+				std::cout << "  MISMATCH: parallel placement " << ( p ? "on" : "off" )
+						  << " differs from sweep" << std::endl;
+				allMatch = false;
+			}
+			printNodes( parallel, result );
+		}
+
+		//Changing the policy stops the workers, and the next advance starts new ones.
+		//	Several workers make a stale round visible even on one core.
+		{
+			ParallelEngine restarted( 4 );
+			result = start;
+			for( int gen = 0; gen < generations; gen++ )
+			{
+				restarted.advance( result, 1 );
+				restarted.setPolicy( gen % 2 ? AFFINITY_SCATTER : AFFINITY_COMPACT, gen % 3 != 0 );
+			}
+			if( !result.sameCells( expected ) )
+			{
+				std::cout << "  MISMATCH: parallel restarted after setPolicy differs from sweep"
+						  << std::endl;
+				allMatch = false;
+			}
+		}
+
+		//Larger-than-Life at radius 1 is Life, then wider neighborhoods cost about the same
+		for( int r = 0; r < 3; r++ )
+		{
+			LtlEngine ltl;
+			ltl.setRule( ltlRules[r] );
+			runEngine( ltl, start, result, generations, sweepTime );
+			if( r == 0 && !result.sameCells( expected ) )
+			{
+				std::cout << "  MISMATCH: ltl " << ltlRules[r] << " differs from sweep"
+						  << std::endl;
+				allMatch = false;
+			}
+		}
+
+		if( !runGenerations( start, "23/3/2", generations, sweepTime, &expected ) )
+			allMatch = false;
+		runGenerations( start, "/2/3", generations, sweepTime, NULL );
+
+		if( !runHistory( start, generations ) )
+			allMatch = false;
+		if( !runViewport( start ) )
+			allMatch = false;
+		if( !runOutput( start, std::min( generations, BENCH_OUTPUT_FRAMES ) ) )
+			allMatch = false;
+	}
+
+	std::cout << std::endl;
+	if( !runLibrary( rows, cols, generations ) )
+		allMatch = false;
+
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	std::cout << std::endl << "Total: " << std::setprecision( 3 )
+			  << std::chrono::duration<double>( end - begin ).count() << " s"
+			  << ( allMatch ? "" : " (MISMATCH)" ) << std::endl;
+
+	return allMatch ? 0 : 1;
+}
+
+/****************************************************************************************
+ * Function: makeGuns( Grid & )
+ * Description: Fills a grid with copies of a World array holding a glider gun
+ * Parameters: The grid to fill
+ * Pre-Conditions: None
+ * Post-Conditions: The grid is tiled with glider guns
+****************************************************************************************/
+void makeGuns( Grid &grid )
+{
+	World world;
+	Cells cell;
+	char display[ROW][COL];
+
+	world.createWorld( display );
+	cell.createGliderGun( display, 10, 30 );
+
+	for( int i = 0; i < grid.getRows(); i += ROW )
+		for( int j = 0; j < grid.getCols(); j += COL )
+			grid.loadWorld( display, i, j );
+}
+
+/****************************************************************************************
+ * Function: runEngine( Engine &, const Grid &, Grid &, int, double )
+ * Description: Times an engine advancing a copy of a board and prints a table row
+ * Parameters: The engine, the starting board, the grid to hold the result, the
+ *		number of generations, and the time of the sweep to compare against (0 if
+ *		this is the sweep)
+ * Pre-Conditions: None
+ * Post-Conditions: The result holds the advanced board. returns the seconds taken
+****************************************************************************************/
+double runEngine( Engine &engine, const Grid &start, Grid &result, int generations,
+		double sweepTime )
+{
+	TemporalEngine *temporal = dynamic_cast<TemporalEngine *>( &engine );
+	ParallelEngine *parallel = dynamic_cast<ParallelEngine *>( &engine );
+	LtlEngine *ltl = dynamic_cast<LtlEngine *>( &engine );
+	double cells = (double)start.getRows() * start.getCols() * generations;
+
+	result = start;
+	engine.resetTraffic();
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	engine.advance( result, generations );
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration<double>( end - begin ).count();
+
+	//Traffic is shown relative to the 2 board copies a sweep moves per generation
+	double perGeneration = (double)engine.getTrafficBytes() / generations;
+	std::ostringstream label;
+	label << engine.getName();
+	if( temporal )
+		label << " k=" << temporal->getDepth();
+	if( parallel )
+		label << ( parallel->getPlacement() ? " numa" : " flat" );
+	if( ltl )
+		label << " R" << ltl->getRadius();
+	std::cout << std::left << std::setw( 14 ) << label.str()
+			  << std::right << std::fixed << std::setprecision( 4 )
+			  << std::setw( 10 ) << seconds
+			  << std::setprecision( 3 ) << std::setw( 12 ) << seconds * 1e9 / cells
+			  << std::setprecision( 1 ) << std::setw( 14 ) << perGeneration / 1024
+			  << std::setprecision( 3 ) << std::setw( 10 )
+			  << perGeneration / (2.0 * start.bytes())
+			  << std::setw( 10 ) << ( sweepTime > 0 ? sweepTime / seconds : 1.0 )
+			  << std::endl;
+
+	return seconds;
+}
+
+/****************************************************************************************
+ * Function: runHistory( const Grid &, int )
+ * Description: Records every generation of a board in a History, then rebuilds
+ *		generations with seek() and checks them against copies taken while stepping,
+ *		and a Viewport following the rebuilt board against a fresh pyramid. Prints the
+ *		compressed size, memory and disk use, and time per seek.
+ * Parameters: The starting board and the number of generations to record
+ * Pre-Conditions: None
+ * Post-Conditions: returns true if every rebuilt generation matched
+****************************************************************************************/
+bool runHistory( const Grid &start, int generations )
+{
+	History history;
+	SweepEngine sweep;
+	Grid board = start;
+	Grid rebuilt;
+	Viewport view;		//Follows the rebuilt board, so a seek must mark what it wrote
+	long long checks[] = { 0, generations / 3, generations / 2 + 1, generations };
+	Grid copies[4];
+	bool match = true;
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	for( int g = 0; g <= generations; g++ )
+	{
+		if( !history.record( board ) )
+		{
+			std::cout << "  History could not record generation " << g << std::endl;
+			return false;
+		}
+		for( int c = 0; c < 4; c++ )
+			if( checks[c] == g )
+				copies[c] = board;
+		sweep.advance( board, 1 );
+	}
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	double recordTime = std::chrono::duration<double>( end - begin ).count();
+
+	begin = std::chrono::steady_clock::now();
+	for( int c = 0; c < 4; c++ )
+		if( !history.seek( checks[c], rebuilt ) || !rebuilt.sameCells( copies[c] ) )
+		{
+			std::cout << "  MISMATCH: history seek to generation " << checks[c]
+					  << std::endl;
+			match = false;
+		}
+	end = std::chrono::steady_clock::now();
+	double seekTime = std::chrono::duration<double>( end - begin ).count() / 4;
+
+	for( int c = 0; c < 4; c++ )
+	{
+		history.seek( checks[c], rebuilt );
+		view.update( rebuilt );
+		if( !samePyramid( view, rebuilt ) )
+		{
+			std::cout << "  MISMATCH: viewport after history seek to generation "
+					  << checks[c] << " differs from a fresh build" << std::endl;
+			match = false;
+		}
+	}
+
+	double raw = (double)history.getFrames() * start.bytes();
+	double stored = (double)history.getMemoryBytes() + history.getDiskBytes();
+	std::cout << "history: " << history.getFrames() << " frames, "
+			  << std::setprecision( 1 ) << stored / 1024 << " KB stored ("
+			  << raw / stored << "x smaller), " << history.getMemoryBytes() / 1024
+			  << " KB in memory, " << history.getDiskBytes() / 1024 << " KB on disk, "
+			  << std::setprecision( 4 ) << recordTime << " s stepping and recording, "
+			  << seekTime * 1000 << " ms per seek" << std::endl;
+
+	return match;
+}
+
+/****************************************************************************************
+ * Function: runGenerations( const Grid &, const char *, int, double, const Grid * )
+ * Description: Times a Generations board running a rule from a starting board and
+ *		prints a table row
+ * Parameters: The starting board, the rule, the number of generations, the time of
+ *		the sweep to compare against, and the board the sweep reached or NULL to skip
+ *		the check
+ * Pre-Conditions: None
+ * Post-Conditions: returns false if the check was made and the alive cells differ
+****************************************************************************************/
+bool runGenerations( const Grid &start, const char *rule, int generations,
+		double sweepTime, const Grid *expected )
+{
+	Generations board( start.getRows(), start.getCols() );
+	Grid alive;
+	double cells = (double)start.getRows() * start.getCols() * generations;
+
+	board.setRule( rule );
+	board.loadGrid( start );
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	board.advance( generations );
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration<double>( end - begin ).count();
+
+	std::cout << std::left << std::setw( 14 ) << ( std::string( "gen " ) + rule )
+			  << std::right << std::fixed << std::setprecision( 4 )
+			  << std::setw( 10 ) << seconds
+			  << std::setprecision( 3 ) << std::setw( 12 ) << seconds * 1e9 / cells
+			  << std::setw( 14 ) << "-" << std::setw( 10 ) << "-"
+			  << std::setw( 10 ) << sweepTime / seconds << std::endl;
+
+	if( !expected )
+		return true;
+	board.storeAlive( alive );
+	if( !alive.sameCells( *expected ) )
+	{
+		std::cout << "  MISMATCH: generations " << rule << " differs from sweep"
+				  << std::endl;
+		return false;
+	}
+	return true;
+}
+
+/****************************************************************************************
+ * Function: runViewport( const Grid & )
+ * Description: Builds a Viewport's pyramid for a board, steps the board one generation
+ *		and updates the pyramid from the changed tiles, then draws the window at several
+ *		zooms. Prints the time of each. Then checks, for every engine and for a soup
+ *		fill, that the pyramid updated from the tiles marked changed matches one built
+ *		fresh at every level.
+ * Parameters: The starting board
+ * Pre-Conditions: None
+ * Post-Conditions: returns false if an updated pyramid differs from a fresh one
+****************************************************************************************/
+bool runViewport( const Grid &start )
+{
+	Viewport view;
+	SweepEngine sweep;
+	Grid board = start;
+	int zooms[] = { 0, 3, 6, 12 };
+	std::ostringstream screen;
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	view.update( board );
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	double buildTime = std::chrono::duration<double>( end - begin ).count();
+
+	sweep.advance( board, 1 );
+	begin = std::chrono::steady_clock::now();
+	long long tiles = view.update( board );
+	end = std::chrono::steady_clock::now();
+	double updateTime = std::chrono::duration<double>( end - begin ).count();
+
+	std::cout << "viewport: " << std::setprecision( 4 ) << buildTime * 1000
+			  << " ms build, " << updateTime * 1000 << " ms update of " << tiles << " of "
+			  << (long long)board.getTileRows() * board.getRowWords()
+			  << " tiles, draw " << view.getHeight() << " X " << view.getWidth();
+
+	//The window is centered on the board so every zoom draws the same screen area
+	for( int z = 0; z < 4; z++ )
+	{
+		view.setZoom( zooms[z] );
+		view.center( board.getRows() / 2, board.getCols() / 2 );
+		screen.str( "" );
+		begin = std::chrono::steady_clock::now();
+		view.render( board, screen );
+		end = std::chrono::steady_clock::now();
+		std::cout << ( z ? ", " : " at zoom " ) << zooms[z] << " "
+				  << std::chrono::duration<double>( end - begin ).count() * 1e6 << " us";
+	}
+	std::cout << std::endl;
+
+	//A tile an engine changes but does not mark leaves the updated pyramid stale
+	TemporalEngine temporal;
+	ParallelEngine parallel;
+	LtlEngine ltl;
+	Engine *engines[] = { &sweep, &temporal, &parallel, &ltl };
+	const char *engineNames[] = { "sweep", "temporal", "parallel", "ltl" };
+	bool match = true;
+
+	ltl.setRule( LTL_LIFE );
+	for( int e = 0; e <= 4; e++ )
+	{
+		Viewport updated;
+		board = start;
+		updated.update( board );
+		if( e < 4 )
+			engines[e]->advance( board, 3 );
+		else
+			Soup( 2, 0.3 ).fill( board );
+		updated.update( board );
+
+		if( !samePyramid( updated, board ) )
+		{
+			std::cout << "  MISMATCH: viewport updated after " << ( e < 4 ? engineNames[e] :
+					"soup fill" ) << " differs from a fresh build" << std::endl;
+			match = false;
+		}
+	}
+	return match;
+}
+
+/****************************************************************************************
+ * Function: samePyramid( const Viewport &, const Grid & )
+ * Description: Compares every block of every level of a Viewport's pyramid with a
+ *		pyramid built fresh from the board
+ * Parameters: The viewport, updated since the board last changed, and the board
+ * Pre-Conditions: None
+ * Post-Conditions: returns false if any block's count differs
+****************************************************************************************/
+bool samePyramid( const Viewport &view, const Grid &board )
+{
+	Viewport fresh;
+	Grid copy = board;
+
+	fresh.update( copy );
+	if( fresh.getTopLevel() != view.getTopLevel() )
+		return false;
+
+	for( int level = VIEW_BASE_LEVEL; level <= view.getTopLevel(); level++ )
+	{
+		long long blockRows = ( ( (long long)board.getRows() - 1 ) >> level ) + 1;
+		long long blockCols = ( ( (long long)board.getCols() - 1 ) >> level ) + 1;
+
+		for( long long r = 0; r < blockRows; r++ )
+			for( long long c = 0; c < blockCols; c++ )
+				if( view.getCount( level, r, c ) != fresh.getCount( level, r, c ) )
+					return false;
+	}
+	return view.getCount( view.getTopLevel(), 0, 0 ) == board.population();
+}
+
+/****************************************************************************************
+ * Function: printNodes( ParallelEngine &, const Grid & )
+ * Description: Prints the workers, rows, local pages and busy time of each NUMA node
+ *		used by a parallel engine
+ * Parameters: The engine and the board it last advanced
+ * Pre-Conditions: The engine has advanced the board
+ * Post-Conditions: One line is printed per node with workers
+****************************************************************************************/
+void printNodes( ParallelEngine &engine, const Grid &board )
+{
+	const Topology &topology = engine.getTopology();
+
+	for( int n = 0; n < topology.getNodes(); n++ )
+	{
+		long long pages = 0;
+		long long local = 0;
+
+		if( engine.getNodeWorkers( n ) == 0 )
+			continue;
+
+		std::cout << "  node " << topology.getNodeId( n ) << ": "
+				  << engine.getNodeWorkers( n ) << " of " << engine.getThreads()
+				  << " workers (" << engine.getPinned() << " pinned "
+				  << Topology::policyName( engine.getPolicy() ) << "), "
+				  << engine.getNodeRows( n ) << " rows, ";
+		if( engine.countNodePages( board, n, pages, local ) )
+			std::cout << local << " of " << pages << " pages local, ";
+		else
+			std::cout << "page placement unknown, ";
+		std::cout << std::setprecision( 4 ) << engine.getNodeSeconds( n ) << " s busy"
+				  << std::endl;
+	}
+}
+
+/****************************************************************************************
+ * Function: sameFile( const std::string &, const std::string & )
+ * Description: Compares the bytes of two files
+ * Parameters: The two file names
+ * Pre-Conditions: None
+ * Post-Conditions: returns true if both open and hold the same bytes
+****************************************************************************************/
+static bool sameFile( const std::string &a, const std::string &b )
+{
+	std::ifstream first( a.c_str(), std::ios::binary );
+	std::ifstream second( b.c_str(), std::ios::binary );
+
+	if( !first || !second )
+		return false;
+	return std::equal( std::istreambuf_iterator<char>( first ), std::istreambuf_iterator<char>(),
+			std::istreambuf_iterator<char>( second ) )
+			&& second.peek() == std::char_traits<char>::eof();
+}
+
+/****************************************************************************************
+ * Function: runOutput( const Grid &, int )
+ * Description: Steps a board and writes every generation in each frame format, once
+ *		inline and once through the background writer. Prints the time of each against
+ *		stepping alone, the writer's stalls, and checks both wrote the same files.
+ * Parameters: The starting board and the number of generations
+ * Pre-Conditions: None
+ * Post-Conditions: The files are removed. returns false if a write failed or the
+ *		files differ
+****************************************************************************************/
+bool runOutput( const Grid &start, int generations )
+{
+	const char *names[] = { "rle", "binary", "pgm" };
+	const char *prefixes[] = { "bench_inline", "bench_async" };
+	SweepEngine sweep;
+	Grid board = start;
+	bool match = true;
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	sweep.advance( board, generations );
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	double stepTime = std::chrono::duration<double>( end - begin ).count();
+
+	for( int f = FRAME_RLE; f <= FRAME_PGM; f++ )
+	{
+		double seconds[2];
+
+		std::cout << "output " << std::left << std::setw( 7 ) << names[f] << std::right;
+		for( int a = 0; a < 2; a++ )
+		{
+			FrameWriter writer( prefixes[a], f, a ? FRAME_SLOTS : 0 );
+
+			board = start;
+			begin = std::chrono::steady_clock::now();
+			for( int g = 0; g < generations; g++ )
+			{
+				sweep.advance( board, 1 );
+				writer.submit( board, g + 1 );
+			}
+			if( !writer.flush() )
+			{
+				std::cout << " write failed";
+				match = false;
+			}
+			end = std::chrono::steady_clock::now();
+			seconds[a] = std::chrono::duration<double>( end - begin ).count();
+
+			std::cout << ( a ? ", async " : " inline " ) << std::setprecision( 4 )
+					  << seconds[a] << " s";
+			if( a )
+				std::cout << " (" << std::setprecision( 2 ) << seconds[0] / seconds[1]
+						  << "x), " << writer.getBytes() / 1024 << " KB in "
+						  << writer.getFrames() << " frames, writer busy "
+						  << std::setprecision( 4 ) << writer.getWriteSeconds() << " s, "
+						  << writer.getStalls() << " stalls ("
+						  << writer.getStallSeconds() << " s), " << writer.getMaxQueued()
+						  << " queued at most";
+		}
+		std::cout << ", stepping alone " << stepTime << " s" << std::endl;
+
+		for( int g = 1; g <= generations; g++ )
+		{
+			std::string inlinePath = FrameWriter::framePath( prefixes[0], f, g );
+			std::string asyncPath = FrameWriter::framePath( prefixes[1], f, g );
+			if( !sameFile( inlinePath, asyncPath ) )
+			{
+				std::cout << "  MISMATCH: " << names[f] << " frame " << g
+						  << " differs between inline and async" << std::endl;
+				match = false;
+			}
+			std::remove( inlinePath.c_str() );
+			std::remove( asyncPath.c_str() );
+			if( f == FRAME_BINARY )
+				break;
+		}
+	}
+
+	return match;
+}
+
+/****************************************************************************************
+ * Function: printSample( const std::string &, const PerfCounters &, double, bool )
+ * Description: Prints a table row of a counter sample: time per cell, IPC, and cycles
+ *		and misses per cell, and the percentage of the time spent on a processor.
+ *		Unavailable counters are shown as "-".
+ * Parameters: The label, the counters, the cells the sample covered, and true for the
+ *		totals rather than the last sample
+ * Pre-Conditions: None
+ * Post-Conditions: One line is printed
+****************************************************************************************/
+static void printSample( const std::string &label, const PerfCounters &counters,
+		double cells, bool total )
+{
+	int events[] = { PERF_CYCLES, PERF_L1D_MISSES, PERF_LLC_MISSES, PERF_BRANCH_MISSES };
+	double seconds = total ? counters.getTotalSeconds() : counters.getSeconds();
+	long long cycles = total ? counters.getTotal( PERF_CYCLES ) : counters.getValue( PERF_CYCLES );
+	long long instructions = total ? counters.getTotal( PERF_INSTRUCTIONS )
+			: counters.getValue( PERF_INSTRUCTIONS );
+
+	std::cout << std::left << std::setw( 14 ) << label << std::right << std::fixed
+			  << std::setprecision( 6 ) << std::setw( 11 ) << seconds
+			  << std::setprecision( 3 ) << std::setw( 10 ) << seconds * 1e9 / cells;
+	if( cycles > 0 && instructions >= 0 )
+		std::cout << std::setw( 8 ) << (double)instructions / cycles;
+	else
+		std::cout << std::setw( 8 ) << "-";
+
+	for( int e = 0; e < 4; e++ )
+	{
+		long long count = total ? counters.getTotal( events[e] )
+				: counters.getValue( events[e] );
+		if( count >= 0 )
+			std::cout << std::setprecision( 4 ) << std::setw( 12 ) << count / cells;
+		else
+			std::cout << std::setw( 12 ) << "-";
+	}
+
+	//The share of the wall time the thread was on a processor
+	long long clock = total ? counters.getTotal( PERF_TASK_CLOCK )
+			: counters.getValue( PERF_TASK_CLOCK );
+	if( clock >= 0 && seconds > 0 )
+		std::cout << std::setprecision( 1 ) << std::setw( 7 ) << clock / ( seconds * 1e7 );
+	else
+		std::cout << std::setw( 7 ) << "-";
+	std::cout << std::endl;
+}
+
+/****************************************************************************************
+ * Function: runLibrary( int, int, int )
+ * Description: Checks the gol library through Simulation. The menu's RLE patterns are
+ *		loaded and compared cell by cell with the Cells functions, plaintext with RLE,
+ *		and a rule in an RLE header must switch the engine. Then a soup is stepped by
+ *		every engine through Simulation and compared with a bare SweepEngine, and
+ *		view() with getCell. Prints the stepping time of each engine.
+ * Parameters: The rows and columns of the board and the number of generations
+ * Pre-Conditions: None
+ * Post-Conditions: returns false if any check failed
+****************************************************************************************/
+bool runLibrary( int rows, int cols, int generations )
+{
+	const char *patterns[] = { LFSO_RLE, GLIDER_RLE, GUN_RLE };
+	const int offsets[][2] = { { LFSO_ROW, LFSO_COL }, { GLIDER_ROW, GLIDER_COL },
+			{ GUN_ROW, GUN_COL } };
+	const char *patternNames[] = { "LFSO", "glider", "glider gun" };
+	const char *engineNames[] = { "sweep", "temporal", "parallel", "ltl" };
+	bool match = true;
+
+	//Each pattern placed at a cell must be what the Cells function drew there
+	for( int p = 0; p < 3; p++ )
+	{
+		World world;
+		Cells cell;
+		char display[ROW][COL];
+		Simulation loaded( ROW, COL, 1 );
+		bool same = true;
+
+		world.createWorld( display );
+		if( p == 0 )
+			cell.createLFSO( display, 10, 30 );
+		else if( p == 1 )
+			cell.createGlider( display, 10, 30 );
+		else
+			cell.createGliderGun( display, 10, 30 );
+
+		if( !loaded.loadPattern( patterns[p], 10 + offsets[p][0], 30 + offsets[p][1] ) )
+			same = false;
+		for( int r = 0; r < ROW && same; r++ )
+			for( int c = 0; c < COL; c++ )
+				if( ( display[r][c] == '0' ) != loaded.getCell( r, c ) )
+					same = false;
+		if( !same )
+		{
+			std::cout << "  MISMATCH: " << patternNames[p] << " loaded from RLE differs from "
+					  << "Cells" << std::endl;
+			match = false;
+		}
+	}
+
+	//The same glider as plaintext, a header rule that switches to ltl and one that is
+	//	Life in Golly's form, and patterns that must be refused
+	{
+		Simulation rle( 16, 16, 1 );
+		Simulation plain( 16, 16, 1 );
+		bool same = rle.loadPattern( GLIDER_RLE, 5, 5 )
+				&& plain.loadPattern( "!Name: glider\nO\n.OO\nOO.\n", 5, 5 );
+		for( int r = 0; r < 16 && same; r++ )
+			for( int c = 0; c < 16; c++ )
+				if( rle.getCell( r, c ) != plain.getCell( r, c ) )
+					same = false;
+
+		same = same && rle.loadPattern( std::string( "x = 3, y = 3, rule = " ) + LTL_BOSCO
+				+ "\n" + GLIDER_RLE, 0, 0 ) && rle.getEngineName() == "ltl"
+				&& rle.getRule() == LTL_BOSCO && !rle.setEngine( "sweep" );
+		same = same && rle.loadPattern( std::string( "#C Life\nx = 3, y = 3, rule = " )
+				+ LTL_LIFE + "\n" + GLIDER_RLE, 0, 0 ) && rle.getRule() == SIM_LIFE
+				&& rle.setEngine( "temporal" );
+
+		long long population = rle.getPopulation();
+		same = same && !rle.loadPattern( "3o$b%!", 0, 0 ) && !rle.loadPattern( GUN_RLE, 12, 0 )
+				&& !rle.loadPattern( "x = 3, y = 3, rule = B3/S2x\n" GLIDER_RLE, 0, 0 )
+				&& rle.getPopulation() == population && rle.getRule() == SIM_LIFE;
+		if( !same )
+		{
+			std::cout << "  MISMATCH: pattern parsing or rule switching through Simulation"
+					  << std::endl;
+			match = false;
+		}
+	}
+
+	//Every engine chosen through Simulation must step a soup as the bare sweep does
+	Grid expected( rows, cols );
+	Soup( 1, 0.5 ).fill( expected );
+	SweepEngine().advance( expected, generations );
+
+	std::cout << "library: " << std::setprecision( 4 );
+	for( int e = 0; e < 4; e++ )
+	{
+		Simulation sim( rows, cols );
+		sim.randomize( 1, 0.5 );
+		if( !sim.setEngine( engineNames[e] ) )
+		{
+			std::cout << std::endl << "  MISMATCH: Simulation refused engine "
+					  << engineNames[e];
+			match = false;
+			continue;
+		}
+
+		//Several calls, so generations counted across steps are checked too
+		sim.step( 1 );
+		sim.step( generations - 1 );
+		std::cout << ( e ? ", " : "" ) << engineNames[e] << " " << sim.getStepSeconds()
+				  << " s";
+		if( sim.getGeneration() != generations || !sameView( sim.view(), expected ) )
+		{
+			std::cout << std::endl << "  MISMATCH: " << engineNames[e]
+					  << " through Simulation differs from sweep";
+			match = false;
+		}
+
+		//Every cell, and the ring just off the board, read the same both ways
+		if( e == 0 )
+		{
+			GridView view = sim.view();
+			for( int r = -1; r <= rows; r++ )
+				for( int c = -1; c <= cols; c++ )
+					if( view.getCell( r, c ) != sim.getCell( r, c ) )
+					{
+						std::cout << std::endl << "  MISMATCH: view() and getCell differ at "
+								  << r << ", " << c;
+						match = false;
+						r = rows;
+						break;
+					}
+		}
+	}
+	std::cout << " through Simulation" << std::endl;
+
+	return match;
+}
+
+/****************************************************************************************
+ * Function: sameView( const GridView &, const Grid & )
+ * Description: Compares a view of a board with a grid word by word
+ * Parameters: The view and the grid
+ * Pre-Conditions: None
+ * Post-Conditions: returns true if the sizes and every cell match
+****************************************************************************************/
+bool sameView( const GridView &view, const Grid &grid )
+{
+	if( view.getRows() != grid.getRows() || view.getCols() != grid.getCols()
+			|| view.getRowWords() != grid.getRowWords() )
+		return false;
+	for( int r = 0; r < grid.getRows(); r++ )
+		if( memcmp( view.row( r ), grid.row( r ), grid.getRowWords() * sizeof( uint64_t ) ) )
+			return false;
+	return true;
+}
+
+/****************************************************************************************
+ * Function: runProfile( const Grid &, int )
+ * Description: Steps a board with the sweep and the temporal engine one pass at a time,
+ *		recording, viewing and writing it after each pass, with each phase under its own
+ *		performance counters. Prints every pass of the step and each phase's total.
+ * Parameters: The starting board and the number of generations
+ * Pre-Conditions: None
+ * Post-Conditions: The profile is printed
+****************************************************************************************/
+void runProfile( const Grid &start, int generations )
+{
+	const char *phases[] = { "step", "record", "view", "output" };
+	double cells = (double)start.getRows() * start.getCols();
+	SweepEngine sweep;
+	TemporalEngine temporal;
+	Engine *engines[] = { &sweep, &temporal };
+
+	for( int e = 0; e < 2; e++ )
+	{
+		PerfCounters counters[4];
+		History history;
+		Viewport view;
+		FrameWriter writer( "bench_profile", FRAME_BINARY );
+		Grid board = start;
+		int pass = engines[e] == &temporal ? temporal.getDepth() : 1;
+
+		if( e == 0 )
+		{
+			if( counters[0].hardware() )
+				std::cout << ", hardware counters" << std::endl;
+			else
+				std::cout << ", hardware counters unavailable ("
+						  << counters[0].getError() << "), timing only" << std::endl;
+		}
+		std::cout << std::endl << engines[e]->getName() << ", " << pass
+				  << ( pass == 1 ? " generation" : " generations" ) << " per pass" << std::endl;
+		std::cout << std::left << std::setw( 14 ) << "generations" << std::right
+				  << std::setw( 11 ) << "seconds" << std::setw( 10 ) << "ns/cell"
+				  << std::setw( 8 ) << "IPC" << std::setw( 12 ) << "cycles/cell"
+				  << std::setw( 12 ) << "L1d/cell" << std::setw( 12 ) << "LLC/cell"
+				  << std::setw( 12 ) << "branch/cell" << std::setw( 7 ) << "cpu%" << std::endl;
+
+		view.update( board );
+		for( int g = 0; g < generations; g += pass )
+		{
+			int n = std::min( pass, generations - g );
+			std::ostringstream label;
+
+			counters[0].start();
+			engines[e]->advance( board, n );
+			counters[0].stop();
+			label << g + 1;
+			if( n > 1 )
+				label << "-" << g + n;
+			printSample( label.str(), counters[0], cells * n, false );
+
+			counters[1].start();
+			history.record( board );
+			counters[1].stop();
+
+			counters[2].start();
+			view.update( board );
+			counters[2].stop();
+
+			counters[3].start();
+			writer.submit( board, g + n );
+			counters[3].stop();
+		}
+		writer.flush();
+		std::remove( FrameWriter::framePath( "bench_profile", FRAME_BINARY, 0 ).c_str() );
+
+		//The step covers every generation, the other phases every board they saw
+		std::cout << "totals" << std::endl;
+		for( int p = 0; p < 4; p++ )
+			printSample( phases[p], counters[p],
+					p == 0 ? cells * generations : cells * counters[p].getSamples(), true );
+	}
+}
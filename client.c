@@ -0,0 +1,151 @@
+/******************************************************************************
+ ** Program Filename: client.c
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: A C99 client of libgol.so through gol.h, built and run by
+			"make check" to show the C interface works from C. It loads the
+			glider gun into a board per engine, records the sweep's frames,
+			steps every board, and checks that golView agrees with golGetCell,
+			that every engine reached the same board, and that the first
+			frame written reads back as the board it was taken from. It also
+			checks that Life written in Golly's form still runs on the sweep
+			and that frames cannot be started with a bad prefix or format.
+ ** Input: An optional prefix for the frame files, "client-frame" by default
+ ** Output: A line for each check that failed. Exits 1 if any failed, else 0.
+ * ***************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "gol.h"
+#include "patterns.h"
+
+#define CLIENT_ROWS 64			//Rows on each board
+#define CLIENT_COLS 256			//Columns on each board
+#define CLIENT_GENERATIONS 120	//Generations stepped, four periods of the gun
+#define CLIENT_PREFIX "client-frame"	//Frame files written by default
+#define CLIENT_ENGINES 4		//Engines checked against each other
+#define CLIENT_LTL_LIFE "R1,C0,M0,S2..3,B3..3,NM"	//Life in Golly's form
+
+static int failures = 0;	//Checks that failed
+
+/****************************************************************************************
+ * Function: check( int, const char * )
+ * Description: Counts and reports a check that failed
+ * Parameters: Whether the check passed and what it checked
+ * Pre-Conditions: None
+ * Post-Conditions: A failed check is printed and counted
+****************************************************************************************/
+static void check( int passed, const char *what )
+{
+	if( !passed )
+	{
+		fprintf( stderr, "client: FAILED %s\n", what );
+		failures++;
+	}
+}
+
+/****************************************************************************************
+ * Function: sameBoard( const GolSimulation *, const GolSimulation * )
+ * Description: Compares the packed boards of two simulations word by word
+ * Parameters: The two simulations
+ * Pre-Conditions: None
+ * Post-Conditions: returns 1 if the sizes and every cell match
+****************************************************************************************/
+static int sameBoard( const GolSimulation *a, const GolSimulation *b )
+{
+	int rowsA, colsA, wordsA, rowsB, colsB, wordsB;
+	const uint64_t *bitsA = golView( a, &rowsA, &colsA, &wordsA );
+	const uint64_t *bitsB = golView( b, &rowsB, &colsB, &wordsB );
+
+	if( rowsA != rowsB || colsA != colsB || wordsA != wordsB || !bitsA || !bitsB )
+		return 0;
+	return memcmp( bitsA, bitsB, (size_t)rowsA * wordsA * sizeof( uint64_t ) ) == 0;
+}
+
+/****************************************************************************************
+ * Function: viewMatchesCells( const GolSimulation * )
+ * Description: Reads every cell of a board from golView and from golGetCell
+ * Parameters: The simulation
+ * Pre-Conditions: None
+ * Post-Conditions: returns 1 if both read the same cells
+****************************************************************************************/
+static int viewMatchesCells( const GolSimulation *sim )
+{
+	int rows, cols, rowWords;
+	const uint64_t *bits = golView( sim, &rows, &cols, &rowWords );
+
+	if( !bits || rows != CLIENT_ROWS || cols != CLIENT_COLS || rowWords != (cols + 63) / 64 )
+		return 0;
+	for( int r = 0; r < rows; r++ )
+		for( int c = 0; c < cols; c++ )
+		{
+			int alive = (int)( (bits[(size_t)r * rowWords + c / 64] >> (c % 64)) & 1 );
+			if( alive != golGetCell( sim, r, c ) )
+				return 0;
+		}
+	return 1;
+}
+
+int main( int argc, char *argv[] )
+{
+	const char *engines[CLIENT_ENGINES] = { "sweep", "temporal", "parallel", "ltl" };
+	const char *prefix = argc > 1 ? argv[1] : CLIENT_PREFIX;
+	GolSimulation *sims[CLIENT_ENGINES];
+	GolSimulation *first, *gun, *life;
+	char name[256];
+
+	for( int e = 0; e < CLIENT_ENGINES; e++ )
+	{
+		sims[e] = golCreate( CLIENT_ROWS, CLIENT_COLS, 2 );
+		if( !sims[e] )
+		{
+			fprintf( stderr, "client: FAILED golCreate\n" );
+			return 1;
+		}
+		check( golSetEngine( sims[e], engines[e] ), engines[e] );
+		check( golLoadPattern( sims[e], GUN_RLE, 10 + GUN_ROW, 30 + GUN_COL ),
+				"golLoadPattern of the glider gun" );
+		check( golPopulation( sims[e] ) == 36, "population of the glider gun" );
+	}
+
+	//Frames start with the board now, then follow every golStep
+	check( !golWriteFrames( sims[1], "no/such/directory/frame", GOL_FRAME_RLE ),
+			"golWriteFrames refuses a prefix that cannot be written" );
+	check( !golWriteFrames( sims[1], prefix, 7 ), "golWriteFrames refuses a bad format" );
+	check( golWriteFrames( sims[0], prefix, GOL_FRAME_RLE ), "golWriteFrames" );
+
+	for( int e = 0; e < CLIENT_ENGINES; e++ )
+	{
+		check( golStep( sims[e], 1 ) && golStep( sims[e], CLIENT_GENERATIONS - 1 ), "golStep" );
+		check( golGeneration( sims[e] ) == CLIENT_GENERATIONS, "golGeneration" );
+		check( viewMatchesCells( sims[e] ), "golView against golGetCell" );
+		if( e > 0 && !sameBoard( sims[e], sims[0] ) )
+			check( 0, engines[e] );
+	}
+	check( golStopFrames( sims[0] ), "golStopFrames" );
+
+	//The first frame read back is the gun as it was loaded
+	snprintf( name, sizeof( name ), "%s.%06d.rle", prefix, 0 );
+	first = golCreate( CLIENT_ROWS, CLIENT_COLS, 1 );
+	gun = golCreate( CLIENT_ROWS, CLIENT_COLS, 1 );
+	check( first && gun && golLoadFile( first, name, 0, 0 )
+			&& golLoadPattern( gun, GUN_RLE, 10 + GUN_ROW, 30 + GUN_COL )
+			&& sameBoard( first, gun ), "reading back the first frame" );
+	check( remove( name ) == 0, "frame of generation 0 written" );
+	snprintf( name, sizeof( name ), "%s.%06d.rle", prefix, 1 );
+	check( remove( name ) == 0, "frame of generation 1 written" );
+	snprintf( name, sizeof( name ), "%s.%06d.rle", prefix, CLIENT_GENERATIONS );
+	check( remove( name ) == 0, "frame of the last generation written" );
+
+	//Life in Golly's form is still Life, so the sweep can run it
+	life = golCreate( CLIENT_ROWS, CLIENT_COLS, 1 );
+	check( life && golSetRule( life, CLIENT_LTL_LIFE ) && golSetEngine( life, "sweep" ),
+			"golSetEngine sweep after golSetRule of Life in Golly's form" );
+
+	golDestroy( life );
+	golDestroy( gun );
+	golDestroy( first );
+	for( int e = 0; e < CLIENT_ENGINES; e++ )
+		golDestroy( sims[e] );
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+ ** Program Filename: engine.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the implementation file for the rule shared by the
+			engines
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#include "engine.hpp"
+
+/********************************************************************************
+*	Function: addNeighbor( uint64_t, uint64_t &, uint64_t &, uint64_t & )
+*	Description: Adds one neighbor word to a bit-sliced counter. Each bit
+*		position counts separately: s0 and s1 hold the count modulo 4 and s2 is
+*		set once the count reaches 4.
+*	Parameters: The neighbor word and the three counter words
+*	Pre-Conditions: None
+*	Post-Conditions: The counters include the neighbor word
+* ******************************************************************************/
+static inline void addNeighbor( uint64_t x, uint64_t &s0, uint64_t &s1, uint64_t &s2 )
+{
+	uint64_t carry0 = s0 & x;
+	s0 ^= x;
+	uint64_t carry1 = s1 & carry0;
+	s1 ^= carry0;
+	s2 |= carry1;
+}
+
+/********************************************************************************
+*	Function: lifeRow( const uint64_t *, const uint64_t *, const uint64_t *,
+*		uint64_t *, int, uint64_t )
+*	Description: Computes the next generation of one packed row, 64 cells per
+*		word, from the row above, the row itself and the row below. Neighbors
+*		beyond the first and last word are dead.
+*	Parameters: The rows above, current and below, the row to write, the number
+*		of words in each row, and the mask to AND into the last word written
+*	Pre-Conditions: All rows hold words words. The output row must not be one
+*		of the input rows. Pass a row of zeros for a row outside the board.
+*	Post-Conditions: The output row holds the next generation
+* ******************************************************************************/
+void lifeRow( const uint64_t *above, const uint64_t *cur, const uint64_t *below,
+		uint64_t *out, int words, uint64_t lastMask )
+{
+	if( words <= 0 )
+		return;
+
+	uint64_t aPrev = 0, cPrev = 0, bPrev = 0;
+	uint64_t a = above[0], c = cur[0], b = below[0];
+
+	for( int w = 0; w < words; w++ )
+	{
+		uint64_t aNext = 0, cNext = 0, bNext = 0;
+		if( w + 1 < words )
+		{
+			aNext = above[w+1];
+			cNext = cur[w+1];
+			bNext = below[w+1];
+		}
+
+		//Shift each neighbor column onto the cell it neighbors, carrying the
+		//	edge bit in from the next word over
+		uint64_t s0 = 0, s1 = 0, s2 = 0;
+		addNeighbor( (a << 1) | (aPrev >> 63), s0, s1, s2 );
+		addNeighbor( a, s0, s1, s2 );
+		addNeighbor( (a >> 1) | (aNext << 63), s0, s1, s2 );
+		addNeighbor( (c << 1) | (cPrev >> 63), s0, s1, s2 );
+		addNeighbor( (c >> 1) | (cNext << 63), s0, s1, s2 );
+		addNeighbor( (b << 1) | (bPrev >> 63), s0, s1, s2 );
+		addNeighbor( b, s0, s1, s2 );
+		addNeighbor( (b >> 1) | (bNext << 63), s0, s1, s2 );
+
+		//3 neighbors: birth or survival. 2 neighbors: survival only.
+		out[w] = s1 & ~s2 & (s0 | c);
+
+		aPrev = a; a = aNext;
+		cPrev = c; c = cNext;
+		bPrev = b; b = bNext;
+	}
+
+	out[words-1] &= lastMask;
+}
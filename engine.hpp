@@ -0,0 +1,82 @@
+/******************************************************************************
+ ** Program Filename: engine.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the Engine class. An Engine
+			advances a Grid by a number of generations of Conway's Game of
+			Life: a live cell with 2 or 3 live neighbors survives and a dead
+			cell with 3 live neighbors is born, the same rules as
+			Cells::cellBirth and Cells::cellDeath. Each way of stepping a
+			board is a class that inherits from Engine. This file also holds
+			lifeRow(), the bit-parallel rule every engine shares.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef ENGINE_HPP
+#define ENGINE_HPP
+#include "grid.hpp"
+
+//Engine Class Declaration
+class Engine
+{
+	protected:
+		long long trafficBytes; //Estimated bytes moved between memory and cache
+
+	public:
+		Engine()
+		{ trafficBytes = 0; }
+
+		virtual ~Engine()
+		{}
+
+		/********************************************************************************
+		*	Function: advance( Grid &, int )
+		*	Description: Advances every cell of a grid by a number of generations
+		*	Parameters: The grid to update and the number of generations
+		*	Pre-Conditions: generations should not be negative
+		*	Post-Conditions: The grid holds the board that many generations later and
+		*		every tile of it that changed is marked (see Grid::markChanged)
+		* ******************************************************************************/
+		virtual void advance( Grid &, int ) = 0;
+
+		/********************************************************************************
+		*	Function: getName()
+		*	Description: Returns a short name of the engine for reports
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the name
+		* ******************************************************************************/
+		virtual const char *getName() const = 0;
+
+		/********************************************************************************
+		*	Function: getTrafficBytes()
+		*	Description: Returns the estimated bytes of board read from and written to
+		*		main memory since the last resetTraffic(). Every pass over data larger
+		*		than the cache is counted, data reused from cache is not.
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the byte count
+		* ******************************************************************************/
+		long long getTrafficBytes() const
+		{ return trafficBytes; }
+
+		void resetTraffic()
+		{ trafficBytes = 0; }
+};
+
+/********************************************************************************
+*	Function: lifeRow( const uint64_t *, const uint64_t *, const uint64_t *,
+*		uint64_t *, int, uint64_t )
+*	Description: Computes the next generation of one packed row, 64 cells per
+*		word, from the row above, the row itself and the row below. Neighbors
+*		beyond the first and last word are dead.
+*	Parameters: The rows above, current and below, the row to write, the number
+*		of words in each row, and the mask to AND into the last word written
+*	Pre-Conditions: All rows hold words words. The output row must not be one
+*		of the input rows. Pass a row of zeros for a row outside the board.
+*	Post-Conditions: The output row holds the next generation
+* ******************************************************************************/
+void lifeRow( const uint64_t *, const uint64_t *, const uint64_t *, uint64_t *,
+		int, uint64_t );
+
+#endif
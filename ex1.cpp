@@ -1,48 +1,116 @@
 /******************************************************************************
- ** Program Filename: Ex1.cpp 
+ ** Program Filename: Ex1.cpp
  ** Author: Wesley Jinks
  ** Date: 1/11/2015
  ** Description: The main file to implement a Game of Life. Has a menu with options
-			to input a cell/cells, view world, insert a glider, insert a glider gun, 
+			to input a cell/cells, view world, insert a glider, insert a glider gun,
 			insert a fixed simple oscillator, choose and watch number of generations
-			pass, clear the worlf and start over, and exit.
+			pass, clear the world and start over, pan and zoom the view, load a
+			pattern file, choose the engine and rule, record frames, and exit. It
+			is a client of the gol library: the board, the window drawn on the
+			screen and the frame files are all the Simulation's.
  ** Input: The option in the menu, location to insert life in the world, and number
 		of generations to watch pass and options to continue.
- ** Output: The game board, prompts for input, iterations of generations on the board.
+ ** Output: The game board, prompts for input, iterations of generations on the board,
+		and frame files while recording.
  * ***************************************************************************/
+#include <algorithm>
 #include <iostream>
+#include <string>
 #include <cstdlib>
 #include <unistd.h>
 #include <cctype>
-#include "world.hpp"
-#include "cells.hpp"
+#include "simulation.hpp"
+#include "patterns.h"
+
+#define EX1_ROWS 1024	//Rows on the board
+#define EX1_COLS 1024	//Columns on the board
+#define EX1_EXIT 12		//Menu option to exit
 
 /****************************************************************************************
- * Function: outputWorld( char[ROW][COL] )
- * Description: loops through array, printing a 22 Row and 80 Column array to the screen
- * Parameters: a character array
- * Pre-Conditions: a character array must be passed
- * Post-Conditions: a 22 row and 80 column array is printed to the screen
+ * Function: outputWorld( Simulation & )
+ * Description: Clears the screen and draws the Simulation's window of the board, with a
+ *		line of the generation, population, engine, rule and zoom
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the window is printed to the screen
  * *************************************************************************************/
-void outputWorld( char[ROW][COL] );
+void outputWorld( Simulation & );
+
+/****************************************************************************************
+ * Function: inputCoords( Simulation &, int &, int & )
+ * Description: Prompts for and gets input for row and column coordinates in the window
+ *		and turns them into the board cell shown there
+ * Parameters: a Simulation, and the row and column to fill
+ * Pre-Conditions: None
+ * Post-Conditions: the row and column are a cell on the board
+****************************************************************************************/
+void inputCoords( Simulation &, int &, int & );
 
 /****************************************************************************************
- * Function: inputCoords( World & )
- * Description: Prompts for and gets input for row and column coordinatesn
- * Parameters: a world object passed by reference
- * Pre-Conditions: a world object must be passed
- * Post-Conditions: world objects row and column coordinates are updated
+ * Function: addPattern( Simulation &, const char *, int, int )
+ * Description: Prompts for a cell and adds a pattern around it
+ * Parameters: a Simulation, the pattern, and the offset of its top left from the cell
+ * Pre-Conditions: None
+ * Post-Conditions: the pattern is on the board, or a message says it did not fit
 ****************************************************************************************/
-void inputCoords( World & );
+void addPattern( Simulation &, const char *, int, int );
 
 /****************************************************************************************
- * Function: passTime( char[ROW][COL], char[ROW][COL], Cells & )
+ * Function: passTime( Simulation & )
  * Description: Prompts for and gets input for number of generations to pass.
- * Parameters: 2 character arrays to update between generations and a Cells object
- * Pre-Conditions: 2 character arrays must be passed, a Cells object must be passed
- * Post-Conditions: character arrays are updated as generations change
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the board is stepped and shown after each generation
 ****************************************************************************************/
-void passTime( char[ROW][COL], char[ROW][COL], Cells & );
+void passTime( Simulation & );
+
+/****************************************************************************************
+ * Function: panZoom( Simulation & )
+ * Description: Moves and zooms the window by keys until asked to stop
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the window shows the chosen part of the board
+****************************************************************************************/
+void panZoom( Simulation & );
+
+/****************************************************************************************
+ * Function: keepOnBoard( Simulation & )
+ * Description: Moves the window back until the cell at its center is on the board, so
+ *		panning never leaves a window with no board cell to enter
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the center of the Simulation's window is a cell of the board
+****************************************************************************************/
+void keepOnBoard( Simulation & );
+
+/****************************************************************************************
+ * Function: loadFile( Simulation & )
+ * Description: Prompts for a pattern file and a cell and loads the file there
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the pattern is on the board, or a message says why not
+****************************************************************************************/
+void loadFile( Simulation & );
+
+/****************************************************************************************
+ * Function: chooseEngine( Simulation & )
+ * Description: Prompts for an engine and a rule
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the engine and rule are set, or a message says they were refused
+****************************************************************************************/
+void chooseEngine( Simulation & );
+
+/****************************************************************************************
+ * Function: recordFrames( Simulation & )
+ * Description: Stops recording if frames are being written, otherwise prompts for a
+ *		file name prefix and a format and starts writing a frame after every generation
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: recording is started or stopped, or a message says why it failed
+****************************************************************************************/
+void recordFrames( Simulation & );
 
 /****************************************************************************************
  * Function: displayMenu()
@@ -55,97 +123,92 @@ void displayMenu();
 
 int main()
 {
-	World world1;				//Creates a world object
-	Cells cell;					//Creates a cell object
-	char display1[ROW][COL];   //Creates an array to display a world
-	char display2[ROW][COL];   //Creates a second array to display a world
+	Simulation world( EX1_ROWS, EX1_COLS );	//The board and its engine
 	int option;				  //Menu option variable
 	char YN;				  //Yes or No option variable
-	
-	// Initialize first and second world display arrays, clear screen, and output world
-	world1.createWorld( display1 ); 
-	world1.createWorld( display2 );
-	system("clear");
-	outputWorld( display1 );
+	int row;				  //Board row of a cell
+	int col;				  //Board column of a cell
 
-	/*Displays menu while choice does not equal 8(exit).
-	 Case 1: output world. 
+	outputWorld( world );
+
+	/*Displays menu while choice does not equal EX1_EXIT.
+	 Case 1: output world.
 	 Case 2: Add cell/cells
 	 Case 3: Add fixed simple oscillator
 	 Case 4: Add glider
 	 Case 5: Add glider gun
 	 Case 6: Choose and watch an amount of generations to pass
 	 Case 7: Clear world and start over
-	 Case 8: Exit     
+	 Case 8: Pan and zoom
+	 Case 9: Load a pattern file
+	 Case 10: Choose the engine and rule
+	 Case 11: Start or stop recording frames
+	 Case 12: Exit
 	*/
 	do
 	{
 		std::cout << std::endl << std::endl << std::endl;
 		displayMenu();
-		std::cout << std::endl << "Enter your choice from the menu 1-8: ";
-		std::cin >> option;
-	
+		std::cout << std::endl << "Enter your choice from the menu 1-" << EX1_EXIT << ": ";
+		if( !( std::cin >> option ) )
+			option = EX1_EXIT;
+
 		switch(option)
 		{
-			case 1: 
-				outputWorld(display1);
+			case 1:
+				outputWorld( world );
 				break;
 			case 2:
-				outputWorld(display1);
+				outputWorld( world );
 				do
 				{
 					std::cout << std::endl;
-					inputCoords( world1 );
-					world1.addLife( display1, world1.getRCoord(), world1.getCCoord() );
-					world1.copyWorldState( display1, display2 );
-					outputWorld( display1 );
+					inputCoords( world, row, col );
+					world.setCell( row, col, true );
+					outputWorld( world );
 					std::cout << std::endl << "Add another cell (Y/N)? ";
 					std::cin >> YN;
 					YN = toupper(YN);
 				}while( YN == 'Y' );
 				break;
 			case 3:
-				std::cout << std::endl;
-				inputCoords( world1 );
-				cell.createLFSO( display1, world1.getRCoord(), world1.getCCoord() );
-				outputWorld( display1 ); 
-				world1.copyWorldState( display1, display2 );
-				break;	
+				addPattern( world, LFSO_RLE, LFSO_ROW, LFSO_COL );
+				break;
 			case 4:
-				std::cout << std::endl;
-				inputCoords( world1 );
-				cell.createGlider( display1, world1.getRCoord(), world1.getCCoord() );
-				world1.copyWorldState( display1, display2 );
-				outputWorld( display1 );
+				addPattern( world, GLIDER_RLE, GLIDER_ROW, GLIDER_COL );
 				break;
 			case 5:
-				std::cout << std::endl;
-				inputCoords( world1 );
-				cell.createGliderGun( display1, world1.getRCoord(), world1.getCCoord() );
-				world1.copyWorldState( display1, display2);
-				outputWorld( display1 );
+				addPattern( world, GUN_RLE, GUN_ROW, GUN_COL );
 				break;
 			case 6:
-				if( cell.getCurrentGeneration() == 0 )  
-					world1.copyWorldState( display1, display2 );
-				else if( cell.getCurrentGeneration() == 1 )
-					world1.copyWorldState( display1, display2 );
-				passTime( display1, display2, cell );
+				passTime( world );
 				break;
 			case 7:
 				std::cout << std::endl << "World Cleared. " << std::endl;
-				world1.createWorld( display1 );
-				world1.createWorld( display2 );
-				outputWorld( display1 );
+				world.clear();
+				outputWorld( world );
 				break;
 			case 8:
+				panZoom( world );
+				break;
+			case 9:
+				loadFile( world );
+				break;
+			case 10:
+				chooseEngine( world );
+				break;
+			case 11:
+				recordFrames( world );
+				break;
+			case EX1_EXIT:
 				std::cout << "Exiting..." << std::endl;
 				break;
 			default:
-				std::cout << "You did not enter a valid choice. Enter option 1-8. " << std::endl;
+				std::cout << "You did not enter a valid choice. Enter option 1-" << EX1_EXIT
+						  << ". " << std::endl;
 		}
 
-	}while( option != 8 );
+	}while( option != EX1_EXIT );
 
 	return 0;
 }
@@ -170,89 +233,126 @@ void displayMenu()
 	std::cout << "* 5: Add Glider Gun                           *" << std::endl;
 	std::cout << "* 6: Watch Time Pass                          *" << std::endl;
 	std::cout << "* 7: Clear World and Start Over               *" << std::endl;
-	std::cout << "* 8: Exit	                              *" << std::endl;
-	std::cout << "*	                                      *" << std::endl;
+	std::cout << "* 8: Pan and Zoom                             *" << std::endl;
+	std::cout << "* 9: Load Pattern File                        *" << std::endl;
+	std::cout << "* 10: Choose Engine and Rule                  *" << std::endl;
+	std::cout << "* 11: Start or Stop Recording Frames          *" << std::endl;
+	std::cout << "* 12: Exit                                    *" << std::endl;
+	std::cout << "*                                             *" << std::endl;
 	std::cout << "***********************************************" << std::endl;
 }
 
 /****************************************************************************************
- * Function: outputWorld( char[ROW][COL] )
- * Description: loops through array, printing a 22 Row and 80 Column array to the screen
- * Parameters: a character array
- * Pre-Conditions: a character array must be passed
- * Post-Conditions: a 22 row and 80 column array is printed to the screen
+ * Function: outputWorld( Simulation & )
+ * Description: Clears the screen and draws the Simulation's window of the board, with a
+ *		line of the generation, population, engine, rule and zoom
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the window is printed to the screen
  * *************************************************************************************/
-void outputWorld( char arr[ROW][COL] )
+void outputWorld( Simulation &world )
 {
-	system("clear");	
-	for( int i = 21; i < ROW-23; i++ )
-	{
-		std::cout << std::endl;
-		for( int j = 79; j < COL-81; j++ )
-			std::cout << arr[i][j];
-	}
-
+	system("clear");
+	world.render( std::cout );
+	std::cout << "Generation " << world.getGeneration() << ", population "
+			  << world.getPopulation() << ", engine " << world.getEngineName()
+			  << ", rule " << world.getRule() << ", zoom "
+			  << world.getZoom() << std::endl;
 }
 
 /****************************************************************************************
- * Function: inputCoords( World & )
- * Description: Prompts for and gets input for row and column coordinatesn
- * Parameters: a world object passed by reference
- * Pre-Conditions: a world object must be passed
- * Post-Conditions: world objects row and column coordinates are updated
+ * Function: inputCoords( Simulation &, int &, int & )
+ * Description: Prompts for and gets input for row and column coordinates in the window
+ *		and turns them into the board cell shown there
+ * Parameters: a Simulation, and the row and column to fill
+ * Pre-Conditions: None
+ * Post-Conditions: the row and column are a cell on the board
 ****************************************************************************************/
-void inputCoords( World &view )
+void inputCoords( Simulation &world, int &boardRow, int &boardCol )
 {
 	int row;		 //row coordinate
 	int col;		 //column coordinate
 	bool rowFlag = 1; //Tests to see if coordinates are within range
 	bool colFlag = 1; //Tests to see if coordinates are within range
+	long long cell = 1LL << world.getZoom(); //Board cells across a character
 
 	//Prompt for, get input, and validate input.
 	do
 	{
 		std::cout << "Enter coordinates for a cell. " << std::endl;
-		std::cout << "Enter Row Number 1-22: ";
+		std::cout << "Enter Row Number 1-" << world.getViewHeight() << ": ";
 		std::cin >> row;
-		std::cout << "Enter Column Number 1-80: ";
+		std::cout << "Enter Column Number 1-" << world.getViewWidth() << ": ";
 		std::cin >> col;
 
-		if( row < 1 || row > 22 )
+		if( row < 1 || row > world.getViewHeight() )
 		{
 			rowFlag = 0;
-			std::cout << "Row input must be between 1 and 22." << std::endl;
+			std::cout << "Row input must be between 1 and " << world.getViewHeight() << "."
+					  << std::endl;
 		}
 		else
 			rowFlag = 1;
 
-		if( col < 1 || col > 80 )
+		if( col < 1 || col > world.getViewWidth() )
 		{
 			colFlag = 0;
-			std::cout << "Column input must be between 1 and 80." << std::endl;
+			std::cout << "Column input must be between 1 and " << world.getViewWidth() << "."
+					  << std::endl;
 		}
 		else
 			colFlag = 1;
 
-	}while( rowFlag == 0 || colFlag == 0 ); 
+		//Shifts the window coordinates to the first board cell the character shows, which
+		//	is its top left unless the character hangs over the top or left edge
+		if( rowFlag && colFlag )
+		{
+			long long r = world.getTop() + (row - 1) * cell;
+			long long c = world.getLeft() + (col - 1) * cell;
+			if( r + cell <= 0 || c + cell <= 0 || r >= world.getRows() || c >= world.getCols() )
+			{
+				rowFlag = 0;
+				std::cout << "That cell is off the board." << std::endl;
+			}
+			else
+			{
+				boardRow = (int)std::max( r, 0LL );
+				boardCol = (int)std::max( c, 0LL );
+			}
+		}
 
-	//Shifts row and column input to be in visible 22 Row and 80 Column display
-	row += 20;
-	col += 78;
+	}while( rowFlag == 0 || colFlag == 0 );
+}
 
-	view.setRCoord( row );
-	view.setCCoord( col );	
+/****************************************************************************************
+ * Function: addPattern( Simulation &, const char *, int, int )
+ * Description: Prompts for a cell and adds a pattern around it
+ * Parameters: a Simulation, the pattern, and the offset of its top left from the cell
+ * Pre-Conditions: None
+ * Post-Conditions: the pattern is on the board, or a message says it did not fit
+****************************************************************************************/
+void addPattern( Simulation &world, const char *pattern, int rowOffset, int colOffset )
+{
+	int row;
+	int col;
+
+	std::cout << std::endl;
+	inputCoords( world, row, col );
+	if( world.loadPattern( pattern, row + rowOffset, col + colOffset ) )
+		outputWorld( world );
+	else
+		std::cout << "The pattern does not fit on the board there." << std::endl;
 }
 
 /****************************************************************************************
- * Function: passTime( char[ROW][COL], char[ROW][COL], Cells & )
+ * Function: passTime( Simulation & )
  * Description: Prompts for and gets input for number of generations to pass, outputs
  *		the changes in generations to the screen
- * Parameters: 2 character arrays to update between generations and a Cells object
- * Pre-Conditions: 2 character arrays must be passed, a Cells object must be passed
- * Post-Conditions: character arrays are updated as generations change and output to
- *		the screen
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the board is stepped and shown after each generation
 ****************************************************************************************/
-void passTime( char world1[ROW][COL], char world2[ROW][COL], Cells &cell )
+void passTime( Simulation &world )
 {
 	char YN;
 	int speed;
@@ -260,18 +360,18 @@ void passTime( char world1[ROW][COL], char world2[ROW][COL], Cells &cell )
 	/*
 	* Prompts for, gets, and validates input for the number of generations and the speed
 	*		to watch them pass.
-	* Pauses based on user input between each generation. Update world based on cell
-	*		newGeneration() function and outputs new world to screen. 
+	* Pauses based on user input between each generation. Steps the board one generation
+	*		and outputs the new world to screen.
 	* Gives option to input and watch more generations
 	*/
 	do
 	{
 		int generations = 0;
-		
+
 		std::cout << "How many generations would you like to pass? ";
 		std::cin >> generations;
 
-		while( generations <= 0 )
+		while( generations <= 0 && std::cin )
 		{
 			std::cout << "The number of generations must be a positive integer. "
 					  << std::endl;
@@ -285,13 +385,13 @@ void passTime( char world1[ROW][COL], char world2[ROW][COL], Cells &cell )
 		std::cin >> speed;
 		std::cout << std::endl;
 
-		while( speed < 1 || speed > 3 )
+		while( ( speed < 1 || speed > 3 ) && std::cin )
 		{
 			std::cout << "Speed can only be slow, medium, or fast. Enter 1 for slow, "
 					  << "2 for medium, or 3 for fast. " << std::endl << "Enter speed:  ";
 			std::cin >> speed;
-		} 
-	
+		}
+
 		for( int i = 0; i < generations; i++ )
 		{
 			if( speed == 1 )
@@ -301,27 +401,165 @@ void passTime( char world1[ROW][COL], char world2[ROW][COL], Cells &cell )
 			else if( speed == 3 )
 				usleep(40000);
 
-			cell.advanceGeneration( world1, world2 );
-		//	cell.newGeneration( world1, world2 );
-			if( cell.getCurrentGeneration() == 1 )  
-			{
-				outputWorld( world2 );
-			//	std::cout << "World2";  //Test for which array is output
-			}
-			else if( cell.getCurrentGeneration() == 0 )
-			{
-				outputWorld( world1 );
-			//	std::cout << "World1";   //Test for which array is output
-			}
-		//	std::cout << cell.getWorldCheck(); //Test to see if worlds are switchin
-			std::cout << std::endl;
+			world.step( 1 );
+			outputWorld( world );
 		}
 
 		std::cout << std::endl << "Would you like to see more generations (Y/N)? ";
-		std::cin >> YN;
+		if( !( std::cin >> YN ) )
+			YN = 'N';
 		YN = toupper( YN );
-	}while( YN != 'N' ); 
+	}while( YN != 'N' );
+}
+
+/****************************************************************************************
+ * Function: panZoom( Simulation & )
+ * Description: Moves and zooms the window by keys until asked to stop. w, a, s and d
+ *		move a quarter of the window, + and - zoom in and out, c centers the board.
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the window shows the chosen part of the board
+****************************************************************************************/
+void panZoom( Simulation &world )
+{
+	char key = ' ';
+
+	do
+	{
+		outputWorld( world );
+		std::cout << std::endl << "w/a/s/d to move, +/- to zoom, c to center, q when done: ";
+		if( !( std::cin >> key ) )
+			key = 'q';
+		key = tolower( key );
+
+		if( key == 'w' )
+			world.pan( -world.getViewHeight() / 4, 0 );
+		else if( key == 's' )
+			world.pan( world.getViewHeight() / 4, 0 );
+		else if( key == 'a' )
+			world.pan( 0, -world.getViewWidth() / 4 );
+		else if( key == 'd' )
+			world.pan( 0, world.getViewWidth() / 4 );
+		else if( key == '+' )
+			world.setZoom( world.getZoom() - 1 );
+		else if( key == '-' )
+			world.setZoom( world.getZoom() + 1 );
+		else if( key == 'c' )
+			world.center( world.getRows() / 2, world.getCols() / 2 );
+		keepOnBoard( world );
+	}while( key != 'q' );
+	outputWorld( world );
+}
+
+/****************************************************************************************
+ * Function: keepOnBoard( Simulation & )
+ * Description: Moves the window back until the cell at its center is on the board, so
+ *		panning never leaves a window with no board cell to enter
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the center of the Simulation's window is a cell of the board
+****************************************************************************************/
+void keepOnBoard( Simulation &world )
+{
+	long long cell = 1LL << world.getZoom();
+	long long midRow = world.getTop() + world.getViewHeight() * cell / 2;
+	long long midCol = world.getLeft() + world.getViewWidth() * cell / 2;
+
+	midRow = std::max( 0LL, std::min( (long long)world.getRows() - 1, midRow ) );
+	midCol = std::max( 0LL, std::min( (long long)world.getCols() - 1, midCol ) );
+	world.center( midRow, midCol );
+}
+
+/****************************************************************************************
+ * Function: loadFile( Simulation & )
+ * Description: Prompts for a pattern file and a cell and loads the file there
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the pattern is on the board, or a message says why not
+****************************************************************************************/
+void loadFile( Simulation &world )
+{
+	std::string name;
+	int row;
+	int col;
+
+	std::cout << std::endl << "Enter the name of an RLE or plaintext pattern file: ";
+	std::cin >> name;
+	std::cout << "Enter the top left cell of the pattern. " << std::endl;
+	inputCoords( world, row, col );
+
+	if( world.loadFile( name, row, col ) )
+		outputWorld( world );
+	else
+		std::cout << "The file could not be read, is not a pattern, has a rule that "
+				  << "cannot be run, or does not fit on the board there." << std::endl;
+}
+
+/****************************************************************************************
+ * Function: chooseEngine( Simulation & )
+ * Description: Prompts for an engine and a rule
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: the engine and rule are set, or a message says they were refused
+****************************************************************************************/
+void chooseEngine( Simulation &world )
+{
+	std::string rule;
+	std::string name;
+
+	std::cout << std::endl << "Enter a rule, B3/S23 for Life or a Larger-than-Life rule "
+			  << "such as R5,C0,M1,S34..58,B34..45,NM: ";
+	std::cin >> rule;
+	if( !world.setRule( rule ) )
+		std::cout << "That rule cannot be run." << std::endl;
+
+	std::cout << "Enter an engine, sweep, temporal, parallel or ltl: ";
+	std::cin >> name;
+	if( !world.setEngine( name ) )
+		std::cout << "That engine does not exist or cannot run " << world.getRule() << "."
+				  << std::endl;
+
+	outputWorld( world );
 }
 
-	
+/****************************************************************************************
+ * Function: recordFrames( Simulation & )
+ * Description: Stops recording if frames are being written, otherwise prompts for a
+ *		file name prefix and a format and starts writing a frame after every generation
+ * Parameters: a Simulation
+ * Pre-Conditions: None
+ * Post-Conditions: recording is started or stopped, or a message says why it failed
+****************************************************************************************/
+void recordFrames( Simulation &world )
+{
+	std::string prefix;
+	int format;
+
+	if( world.writingFrames() )
+	{
+		if( world.stopFrames() )
+			std::cout << std::endl << "Recording stopped." << std::endl;
+		else
+			std::cout << std::endl << "Recording stopped, some frames could not be written."
+					  << std::endl;
+		return;
+	}
+
+	std::cout << std::endl << "Enter the start of the frame file names: ";
+	std::cin >> prefix;
+	std::cout << "Enter the format, " << SIM_FRAME_RLE << " for RLE, " << SIM_FRAME_BINARY
+			  << " for binary frames or " << SIM_FRAME_PGM << " for PGM images: ";
+	if( !( std::cin >> format ) )
+	{
+		std::cin.clear();
+		std::cin.ignore( 256, '\n' );
+		format = -1;
+	}
 
+	if( world.writeFrames( prefix, format ) )
+		std::cout << "Recording to " << Simulation::framePath( prefix, format,
+				world.getGeneration() ) << " and on." << std::endl;
+	else
+		std::cout << "That format does not exist or the frames cannot be written there."
+				  << std::endl;
+}
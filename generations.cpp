@@ -0,0 +1,521 @@
+/******************************************************************************
+ ** Program Filename: generations.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the Generations class function implementation file
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+#include "generations.hpp"
+
+/********************************************************************************
+*	Function: planesFor( int )
+*	Description: Returns the number of bit-planes needed for a number of states
+*	Parameters: The number of states
+*	Pre-Conditions: states is 2 or more
+*	Post-Conditions: returns the bits needed to hold states-1
+* ******************************************************************************/
+static int planesFor( int states )
+{
+	int bits = 0;
+	while( (1 << bits) < states )
+		bits++;
+	return bits;
+}
+
+/********************************************************************************
+*	Function: parseCounts( const std::string &, int & )
+*	Description: Parses a run of neighbor counts such as "23" into a bit set
+*	Parameters: The digits and the set to fill
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if a character is not a digit 0-8
+* ******************************************************************************/
+static bool parseCounts( const std::string &digits, int &set )
+{
+	set = 0;
+	for( size_t i = 0; i < digits.size(); i++ )
+	{
+		if( digits[i] < '0' || digits[i] > '8' )
+			return false;
+		set |= 1 << (digits[i] - '0');
+	}
+	return true;
+}
+
+/********************************************************************************
+*	Function: parseStates( const std::string &, int & )
+*	Description: Parses the number of states of a rule
+*	Parameters: The digits and the number to fill
+*	Pre-Conditions: None
+*	Post-Conditions: returns false unless the digits are 2-GENERATIONS_MAX_STATES
+* ******************************************************************************/
+static bool parseStates( const std::string &digits, int &count )
+{
+	if( digits.empty() || digits.size() > 3 )
+		return false;
+	for( size_t i = 0; i < digits.size(); i++ )
+		if( !isdigit( (unsigned char)digits[i] ) )
+			return false;
+	count = atoi( digits.c_str() );
+	return count >= 2 && count <= GENERATIONS_MAX_STATES;
+}
+
+/********************************************************************************
+*	Function: Generations( int, int )
+*	Description: Constructor of an empty board running Conway's Life ("23/3/2")
+*	Parameters: The first int is the number of rows, the second the number of
+*		columns
+*	Pre-Conditions: rows and columns should not be negative
+*	Post-Conditions: Every cell is dead
+* ******************************************************************************/
+Generations::Generations( int rows, int cols )
+{
+	states = 2;
+	survive = (1 << 2) | (1 << 3);
+	birth = 1 << 3;
+	generation = 0;
+	planes.assign( 1, Grid( rows, cols ) );
+	next.assign( 1, Grid( rows, cols ) );
+}
+
+/********************************************************************************
+*	Function: setRule( const std::string & )
+*	Description: Parses and sets a rule. Accepts "S/B/C" as in "/2/3", "S/B"
+*		for a two-state rule, and the lettered "B2/S/C3" in any order.
+*		When the number of states changes only the alive cells are kept.
+*	Parameters: The rule string
+*	Pre-Conditions: None
+*	Post-Conditions: returns false and leaves the rule unchanged if the string
+*		is not a rule. Counts are 0-8 and states 2-GENERATIONS_MAX_STATES.
+* ******************************************************************************/
+bool Generations::setRule( const std::string &rule )
+{
+	std::vector<std::string> parts;
+	std::string part;
+	std::istringstream in( rule );
+	int newSurvive = 0, newBirth = 0, newStates = 2;
+
+	while( std::getline( in, part, '/' ) )
+		parts.push_back( part );
+	if( !rule.empty() && rule[rule.size()-1] == '/' )
+		parts.push_back( "" );
+	if( parts.size() < 2 || parts.size() > 3 )
+		return false;
+
+	if( !parts[0].empty() && isalpha( (unsigned char)parts[0][0] ) )
+	{
+		//Lettered form: each part names what it holds
+		bool seen[3] = { false, false, false };
+		for( size_t i = 0; i < parts.size(); i++ )
+		{
+			if( parts[i].empty() )
+				return false;
+			char kind = toupper( (unsigned char)parts[i][0] );
+			std::string digits = parts[i].substr( 1 );
+			bool ok = false;
+
+			if( kind == 'S' && !seen[0] )
+			{
+				ok = parseCounts( digits, newSurvive );
+				seen[0] = true;
+			}
+			else if( kind == 'B' && !seen[1] )
+			{
+				ok = parseCounts( digits, newBirth );
+				seen[1] = true;
+			}
+			else if( ( kind == 'C' || kind == 'G' ) && !seen[2] )
+			{
+				ok = parseStates( digits, newStates );
+				seen[2] = true;
+			}
+			if( !ok )
+				return false;
+		}
+		if( !seen[0] || !seen[1] )
+			return false;
+	}
+	else
+	{
+		if( !parseCounts( parts[0], newSurvive ) || !parseCounts( parts[1], newBirth ) )
+			return false;
+		if( parts.size() == 3 && !parseStates( parts[2], newStates ) )
+			return false;
+	}
+
+	if( newStates != states )
+	{
+		Grid keep;
+		storeAlive( keep );
+		states = newStates;
+		planes.assign( planesFor( states ), Grid( keep.getRows(), keep.getCols() ) );
+		next = planes;
+		loadGrid( keep );
+	}
+	survive = newSurvive;
+	birth = newBirth;
+	return true;
+}
+
+/********************************************************************************
+*	Function: getRule()
+*	Description: Returns the rule in "S/B/C" form
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns the rule string
+* ******************************************************************************/
+std::string Generations::getRule() const
+{
+	std::ostringstream out;
+
+	for( int n = 0; n <= 8; n++ )
+		if( (survive >> n) & 1 )
+			out << n;
+	out << '/';
+	for( int n = 0; n <= 8; n++ )
+		if( (birth >> n) & 1 )
+			out << n;
+	out << '/' << states;
+	return out.str();
+}
+
+/********************************************************************************
+*	Function: clear()
+*	Description: Sets every cell to dead
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: Every plane is cleared
+* ******************************************************************************/
+void Generations::clear()
+{
+	for( size_t p = 0; p < planes.size(); p++ )
+		planes[p].clear();
+	generation = 0;
+}
+
+/********************************************************************************
+*	Function: getCell( int, int )
+*	Description: Returns the state of the cell at a row and column. Cells
+*		outside the board are dead.
+*	Parameters: The first int is a row, the second a column
+*	Pre-Conditions: None
+*	Post-Conditions: returns the state, 0 to states-1
+* ******************************************************************************/
+int Generations::getCell( int r, int c ) const
+{
+	int state = 0;
+	for( size_t p = 0; p < planes.size(); p++ )
+		if( planes[p].getCell( r, c ) )
+			state |= 1 << p;
+	return state;
+}
+
+/********************************************************************************
+*	Function: setCell( int, int, int )
+*	Description: Sets the state of the cell at a row and column. Cells outside
+*		the board and states outside 0 to states-1 are ignored.
+*	Parameters: The first int is a row, the second a column, the third a state
+*	Pre-Conditions: None
+*	Post-Conditions: The cell is updated
+* ******************************************************************************/
+void Generations::setCell( int r, int c, int state )
+{
+	if( state < 0 || state >= states )
+		return;
+	for( size_t p = 0; p < planes.size(); p++ )
+		planes[p].setCell( r, c, (state >> p) & 1 );
+}
+
+/********************************************************************************
+*	Function: loadGrid( const Grid & )
+*	Description: Replaces the board with the live cells of a two-state grid
+*	Parameters: The grid
+*	Pre-Conditions: The grid is the size of the board
+*	Post-Conditions: Live cells of the grid are alive, every other cell dead
+* ******************************************************************************/
+void Generations::loadGrid( const Grid &grid )
+{
+	planes[0] = grid;
+	for( size_t p = 1; p < planes.size(); p++ )
+		planes[p].resize( grid.getRows(), grid.getCols() );
+	for( size_t p = 0; p < next.size(); p++ )
+		next[p].resize( grid.getRows(), grid.getCols() );
+	generation = 0;
+}
+
+/********************************************************************************
+*	Function: storeAlive( Grid & )
+*	Description: Copies the alive (state 1) cells into a two-state grid
+*	Parameters: The grid
+*	Pre-Conditions: None
+*	Post-Conditions: The grid is the size of the board and holds its alive cells
+* ******************************************************************************/
+void Generations::storeAlive( Grid &grid ) const
+{
+	grid = planes[0];
+	for( int r = 0; r < grid.getRows(); r++ )
+		alive( r, grid.row( r ) );
+}
+
+/********************************************************************************
+*	Function: alive( int, uint64_t * )
+*	Description: Finds the alive (state 1) cells of a row
+*	Parameters: The row, and the words to write, zeros for a row off the board
+*	Pre-Conditions: The output holds a row of words
+*	Post-Conditions: Bits of alive cells are set
+* ******************************************************************************/
+void Generations::alive( int r, uint64_t *out ) const
+{
+	int words = planes[0].getRowWords();
+
+	if( r < 0 || r >= planes[0].getRows() )
+	{
+		for( int w = 0; w < words; w++ )
+			out[w] = 0;
+		return;
+	}
+
+	for( int w = 0; w < words; w++ )
+		out[w] = planes[0].row( r )[w];
+	for( size_t p = 1; p < planes.size(); p++ )
+		for( int w = 0; w < words; w++ )
+			out[w] &= ~planes[p].row( r )[w];
+}
+
+/********************************************************************************
+*	Function: countNeighbors( const uint64_t[8], uint64_t[4] )
+*	Description: Adds 8 neighbor words into a 4 bit, bit-sliced count with a
+*		tree of full adders
+*	Parameters: The neighbor words and the count words, lowest bit first
+*	Pre-Conditions: None
+*	Post-Conditions: Each bit position of the count holds its number of
+*		neighbors, 0 to 8
+* ******************************************************************************/
+static inline void countNeighbors( const uint64_t n[8], uint64_t count[4] )
+{
+	uint64_t t, sumA, carryA, sumB, carryB, sumC, carryC, carryD, sumE, carryE, carryF;
+
+	t = n[0] ^ n[1]; sumA = t ^ n[2]; carryA = (n[0] & n[1]) | (t & n[2]);
+	t = n[3] ^ n[4]; sumB = t ^ n[5]; carryB = (n[3] & n[4]) | (t & n[5]);
+	sumC = n[6] ^ n[7]; carryC = n[6] & n[7];
+
+	//Ones
+	t = sumA ^ sumB; count[0] = t ^ sumC; carryD = (sumA & sumB) | (t & sumC);
+
+	//Twos, from the four carries of the ones
+	t = carryA ^ carryB; sumE = t ^ carryC; carryE = (carryA & carryB) | (t & carryC);
+	count[1] = sumE ^ carryD; carryF = sumE & carryD;
+
+	//Fours and eight
+	count[2] = carryE ^ carryF;
+	count[3] = carryE & carryF;
+}
+
+/********************************************************************************
+*	Function: listCounts( int, int[9] )
+*	Description: Lists the counts in a set of neighbor counts
+*	Parameters: The set and the list to fill
+*	Pre-Conditions: None
+*	Post-Conditions: returns the number of counts listed
+* ******************************************************************************/
+static int listCounts( int set, int list[9] )
+{
+	int size = 0;
+	for( int n = 0; n <= 8; n++ )
+		if( (set >> n) & 1 )
+			list[size++] = n;
+	return size;
+}
+
+/********************************************************************************
+*	Function: matchCounts( const uint64_t[4], const int *, int )
+*	Description: Finds the cells whose neighbor count is in a list
+*	Parameters: The counter words, the list of counts and its size
+*	Pre-Conditions: None
+*	Post-Conditions: returns a word with the bits of matching cells set
+* ******************************************************************************/
+static inline uint64_t matchCounts( const uint64_t count[4], const int *list, int size )
+{
+	uint64_t match = 0;
+
+	for( int i = 0; i < size; i++ )
+	{
+		int n = list[i];
+		match |= ( n & 1 ? count[0] : ~count[0] ) & ( n & 2 ? count[1] : ~count[1] ) &
+				 ( n & 4 ? count[2] : ~count[2] ) & ( n & 8 ? count[3] : ~count[3] );
+	}
+	return match;
+}
+
+/********************************************************************************
+*	Function: stepRow<BITS>( const uint64_t *, const uint64_t *, const uint64_t *,
+*		const uint64_t *const *, uint64_t *const *, int, int, const int *, int,
+*		const int *, int )
+*	Description: Advances one row of a board with BITS planes one generation.
+*		Cells that are born, and cells that are not dead and do not survive,
+*		move up one state; cells moving past the last state wrap to dead. The
+*		state of 64 cells is incremented at once by rippling a carry through the
+*		planes. The number of planes is a template argument so the loops over
+*		the planes unroll.
+*	Parameters: The alive cells of the rows above, at and below the row, the
+*		planes of the row, the planes to write, the number of words, the last
+*		state, and the survival and birth lists with their sizes
+*	Pre-Conditions: All rows hold the number of words
+*	Post-Conditions: The planes written hold the row one generation on
+* ******************************************************************************/
+template <int BITS>
+static void stepRow( const uint64_t *above, const uint64_t *cur, const uint64_t *below,
+		const uint64_t *const *from, uint64_t *const *to, int words, int lastState,
+		const int *surviveList, int surviveSize, const int *birthList, int birthSize )
+{
+	uint64_t aPrev = 0, cPrev = 0, bPrev = 0;
+
+	for( int w = 0; w < words; w++ )
+	{
+		uint64_t aNext = 0, cNext = 0, bNext = 0;
+		if( w + 1 < words )
+		{
+			aNext = above[w+1];
+			cNext = cur[w+1];
+			bNext = below[w+1];
+		}
+
+		uint64_t n[8] = {
+			(above[w] << 1) | (aPrev >> 63), above[w], (above[w] >> 1) | (aNext << 63),
+			(cur[w] << 1) | (cPrev >> 63), (cur[w] >> 1) | (cNext << 63),
+			(below[w] << 1) | (bPrev >> 63), below[w], (below[w] >> 1) | (bNext << 63) };
+		uint64_t count[4];
+		countNeighbors( n, count );
+
+		uint64_t state[BITS];
+		uint64_t dead = ~(uint64_t)0;
+		uint64_t last = ~(uint64_t)0;  //Cells in the last state
+		for( int p = 0; p < BITS; p++ )
+		{
+			state[p] = from[p][w];
+			dead &= ~state[p];
+			last &= ( (lastState >> p) & 1 ) ? state[p] : ~state[p];
+		}
+
+		uint64_t keep = cur[w] & matchCounts( count, surviveList, surviveSize );
+		uint64_t born = dead & matchCounts( count, birthList, birthSize );
+		uint64_t inc = ( ~dead & ~keep ) | born;
+		uint64_t wrap = inc & last;
+		uint64_t carry = inc & ~wrap;
+
+		for( int p = 0; p < BITS; p++ )
+		{
+			uint64_t bit = state[p] ^ carry;
+			carry &= state[p];
+			to[p][w] = bit & ~wrap;
+		}
+
+		aPrev = above[w];
+		cPrev = cur[w];
+		bPrev = below[w];
+	}
+}
+
+/********************************************************************************
+*	Function: step()
+*	Description: Advances the board one generation, a row at a time, keeping
+*		the alive cells of the rows above, at and below the row in aliveRows
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: The board is one generation on
+* ******************************************************************************/
+void Generations::step()
+{
+	int rows = planes[0].getRows();
+	int words = planes[0].getRowWords();
+	int bits = (int)planes.size();
+	uint64_t lastMask = planes[0].getLastMask();
+	int surviveList[9], birthList[9];
+	int surviveSize = listCounts( survive, surviveList );
+	int birthSize = listCounts( birth, birthList );
+
+	if( rows == 0 || words == 0 )
+		return;
+
+	aliveRows.resize( 3 * (size_t)words );
+	uint64_t *above = &aliveRows[0];
+	uint64_t *cur = above + words;
+	uint64_t *below = cur + words;
+	alive( -1, above );
+	alive( 0, cur );
+	alive( 1, below );
+
+	for( int r = 0; r < rows; r++ )
+	{
+		const uint64_t *from[8];
+		uint64_t *to[8];
+		for( int p = 0; p < bits; p++ )
+		{
+			from[p] = planes[p].row( r );
+			to[p] = next[p].row( r );
+		}
+
+		switch( bits )
+		{
+			#define STEP_ROW( B ) case B: stepRow<B>( above, cur, below, from, to, words, \
+					states - 1, surviveList, surviveSize, birthList, birthSize ); break;
+			STEP_ROW( 1 ) STEP_ROW( 2 ) STEP_ROW( 3 ) STEP_ROW( 4 )
+			STEP_ROW( 5 ) STEP_ROW( 6 ) STEP_ROW( 7 ) STEP_ROW( 8 )
+			#undef STEP_ROW
+		}
+
+		for( int p = 0; p < bits; p++ )
+			to[p][words-1] &= lastMask;
+
+		uint64_t *spare = above;
+		above = cur;
+		cur = below;
+		below = spare;
+		alive( r + 2, below );
+	}
+
+	for( int p = 0; p < bits; p++ )
+		planes[p].swap( next[p] );
+	generation++;
+}
+
+/********************************************************************************
+*	Function: advance( int )
+*	Description: Advances the board a number of generations
+*	Parameters: The number of generations
+*	Pre-Conditions: generations should not be negative
+*	Post-Conditions: The board is that many generations on
+* ******************************************************************************/
+void Generations::advance( int generations )
+{
+	for( int g = 0; g < generations; g++ )
+		step();
+}
+
+/********************************************************************************
+*	Function: countState( int )
+*	Description: Counts the cells in a state
+*	Parameters: The state
+*	Pre-Conditions: None
+*	Post-Conditions: returns the number of cells in that state
+* ******************************************************************************/
+long long Generations::countState( int state ) const
+{
+	long long total = 0;
+	int words = planes[0].getRowWords();
+
+	for( int r = 0; r < planes[0].getRows(); r++ )
+		for( int w = 0; w < words; w++ )
+		{
+			uint64_t match = ~(uint64_t)0;
+			for( size_t p = 0; p < planes.size(); p++ )
+				match &= ( (state >> p) & 1 ) ? planes[p].row( r )[w] : ~planes[p].row( r )[w];
+			if( w == words - 1 )
+				match &= planes[0].getLastMask();
+			total += __builtin_popcountll( match );
+		}
+	return total;
+}
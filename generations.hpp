@@ -0,0 +1,165 @@
+/******************************************************************************
+ ** Program Filename: generations.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the Generations class. It runs
+			the "Generations" family of cellular automata, where a cell has
+			states 0 (dead), 1 (alive) and 2 through states-1 (dying). A dead
+			cell is born when its count of alive neighbors is in the birth
+			set, an alive cell stays alive when its count is in the survival
+			set and otherwise starts dying, and a dying cell moves one state
+			on each generation until it wraps back to dead. Dying cells do not
+			count as neighbors. Conway's Life is "23/3/2" and Brian's Brain is
+			"/2/3". The state of each cell is spread across bit-planes, plane
+			j holding bit j of the state, each a Grid, so every step works on
+			64 cells at a time like the two-state engines.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef GENERATIONS_HPP
+#define GENERATIONS_HPP
+#include <string>
+#include <vector>
+#include "grid.hpp"
+
+#define GENERATIONS_MAX_STATES 256   //Most states a rule may have
+
+//Generations Class Declaration
+class Generations
+{
+	private:
+		int states;			//Number of states, 2 or more
+		int survive;		//Bit n set when n alive neighbors keep a cell alive
+		int birth;			//Bit n set when n alive neighbors bring a cell to life
+		std::vector<Grid> planes; //Bit j of every cell's state is in planes[j]
+		std::vector<Grid> next;	  //Planes of the next generation
+		std::vector<uint64_t> aliveRows; //Alive cells of the rows above, at and below
+		long long generation;	//Generations stepped since the board was set
+
+		void step();
+		void alive( int, uint64_t * ) const;
+
+	public:
+		/********************************************************************************
+		*	Function: Generations( int, int )
+		*	Description: Constructor of an empty board running Conway's Life ("23/3/2")
+		*	Parameters: The first int is the number of rows, the second the number of
+		*		columns
+		*	Pre-Conditions: rows and columns should not be negative
+		*	Post-Conditions: Every cell is dead
+		* ******************************************************************************/
+		Generations( int, int );
+
+		/********************************************************************************
+		*	Function: setRule( const std::string & )
+		*	Description: Parses and sets a rule. Accepts "S/B/C" as in "/2/3", "S/B"
+		*		for a two-state rule, and the lettered "B2/S/C3" in any order.
+		*		When the number of states changes only the alive cells are kept.
+		*	Parameters: The rule string
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false and leaves the rule unchanged if the string
+		*		is not a rule. Counts are 0-8 and states 2-GENERATIONS_MAX_STATES.
+		* ******************************************************************************/
+		bool setRule( const std::string & );
+
+		/********************************************************************************
+		*	Function: getRule()
+		*	Description: Returns the rule in "S/B/C" form
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the rule string
+		* ******************************************************************************/
+		std::string getRule() const;
+
+		/********************************************************************************
+		*	Function: clear()
+		*	Description: Sets every cell to dead
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: Every plane is cleared
+		* ******************************************************************************/
+		void clear();
+
+		/********************************************************************************
+		*	Function: getCell( int, int )
+		*	Description: Returns the state of the cell at a row and column. Cells
+		*		outside the board are dead.
+		*	Parameters: The first int is a row, the second a column
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the state, 0 to states-1
+		* ******************************************************************************/
+		int getCell( int, int ) const;
+
+		/********************************************************************************
+		*	Function: setCell( int, int, int )
+		*	Description: Sets the state of the cell at a row and column. Cells outside
+		*		the board and states outside 0 to states-1 are ignored.
+		*	Parameters: The first int is a row, the second a column, the third a state
+		*	Pre-Conditions: None
+		*	Post-Conditions: The cell is updated
+		* ******************************************************************************/
+		void setCell( int, int, int );
+
+		/********************************************************************************
+		*	Function: loadGrid( const Grid & )
+		*	Description: Replaces the board with the live cells of a two-state grid
+		*	Parameters: The grid
+		*	Pre-Conditions: The grid is the size of the board
+		*	Post-Conditions: Live cells of the grid are alive, every other cell dead
+		* ******************************************************************************/
+		void loadGrid( const Grid & );
+
+		/********************************************************************************
+		*	Function: storeAlive( Grid & )
+		*	Description: Copies the alive (state 1) cells into a two-state grid
+		*	Parameters: The grid
+		*	Pre-Conditions: None
+		*	Post-Conditions: The grid is the size of the board and holds its alive cells
+		* ******************************************************************************/
+		void storeAlive( Grid & ) const;
+
+		/********************************************************************************
+		*	Function: advance( int )
+		*	Description: Advances the board a number of generations
+		*	Parameters: The number of generations
+		*	Pre-Conditions: generations should not be negative
+		*	Post-Conditions: The board is that many generations on
+		* ******************************************************************************/
+		void advance( int );
+
+		/********************************************************************************
+		*	Function: countState( int )
+		*	Description: Counts the cells in a state
+		*	Parameters: The state
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the number of cells in that state
+		* ******************************************************************************/
+		long long countState( int ) const;
+
+		/********************************************************************************
+		*	Function: getPlane( int )
+		*	Description: Returns a bit-plane of the board without copying it
+		*	Parameters: The plane, 0 for the lowest bit of the state
+		*	Pre-Conditions: The plane is less than getPlanes()
+		*	Post-Conditions: returns the plane
+		* ******************************************************************************/
+		const Grid &getPlane( int p ) const
+		{ return planes[p]; }
+
+		int getPlanes() const
+		{ return (int)planes.size(); }
+
+		int getStates() const
+		{ return states; }
+
+		int getRows() const
+		{ return planes[0].getRows(); }
+
+		int getCols() const
+		{ return planes[0].getCols(); }
+
+		long long getGeneration() const
+		{ return generation; }
+};
+
+#endif
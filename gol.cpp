@@ -0,0 +1,306 @@
+/******************************************************************************
+ ** Program Filename: gol.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the C interface implementation file of the gol
+			library. A GolSimulation handle is a Simulation, and every
+			function that can allocate catches exceptions so none reach C.
+ ** Input: None
+ ** Output: Frame files
+ * ***************************************************************************/
+#include <new>
+#include "gol.h"
+#include "simulation.hpp"
+
+static_assert( GOL_FRAME_RLE == SIM_FRAME_RLE && GOL_FRAME_BINARY == SIM_FRAME_BINARY
+		&& GOL_FRAME_PGM == SIM_FRAME_PGM, "gol.h frame formats must match simulation.hpp" );
+
+/********************************************************************************
+*	Function: sim( GolSimulation * ), sim( const GolSimulation * )
+*	Description: Returns the Simulation a handle stands for
+*	Parameters: The handle
+*	Pre-Conditions: The handle came from golCreate
+*	Post-Conditions: returns the simulation
+* ******************************************************************************/
+static Simulation *sim( GolSimulation *handle )
+{
+	return reinterpret_cast<Simulation *>( handle );
+}
+
+static const Simulation *sim( const GolSimulation *handle )
+{
+	return reinterpret_cast<const Simulation *>( handle );
+}
+
+/********************************************************************************
+*	Function: golCreate( int, int, int ), golDestroy( GolSimulation * )
+*	Description: Creates an empty board stepped by the sweep under Life, and
+*		frees one
+*	Parameters: The rows and columns of the board, and the threads the parallel
+*		engines use, 0 for one per core; or the simulation to free
+*	Pre-Conditions: None
+*	Post-Conditions: golCreate returns NULL if the board cannot be allocated
+* ******************************************************************************/
+GolSimulation *golCreate( int rows, int cols, int threads )
+{
+	if( rows < 0 || cols < 0 )
+		return NULL;
+	try
+	{
+		return reinterpret_cast<GolSimulation *>( new Simulation( rows, cols, threads ) );
+	}
+	catch( ... )
+	{
+		return NULL;
+	}
+}
+
+void golDestroy( GolSimulation *handle )
+{
+	delete sim( handle );
+}
+
+/********************************************************************************
+*	Function: golSetEngine( GolSimulation *, const char * ),
+*		golSetRule( GolSimulation *, const char * )
+*	Description: Chooses the engine by name or sets the rule
+*	Parameters: The simulation and the name or rule
+*	Pre-Conditions: None
+*	Post-Conditions: returns 0 and changes nothing if the name or rule is refused
+* ******************************************************************************/
+int golSetEngine( GolSimulation *handle, const char *name )
+{
+	try
+	{
+		return name && sim( handle )->setEngine( name );
+	}
+	catch( ... )
+	{
+		return 0;
+	}
+}
+
+int golSetRule( GolSimulation *handle, const char *rule )
+{
+	try
+	{
+		return rule && sim( handle )->setRule( rule );
+	}
+	catch( ... )
+	{
+		return 0;
+	}
+}
+
+/********************************************************************************
+*	Function: golLoadPattern( GolSimulation *, const char *, int, int ),
+*		golLoadFile( GolSimulation *, const char *, int, int )
+*	Description: Adds an RLE or plaintext pattern, given as text or a file name
+*	Parameters: The simulation, the pattern or file, and the board row and column
+*		of the pattern's top left cell
+*	Pre-Conditions: None
+*	Post-Conditions: returns 0 and leaves the board unchanged if it cannot be
+*		loaded
+* ******************************************************************************/
+int golLoadPattern( GolSimulation *handle, const char *text, int row, int col )
+{
+	try
+	{
+		return text && sim( handle )->loadPattern( text, row, col );
+	}
+	catch( ... )
+	{
+		return 0;
+	}
+}
+
+int golLoadFile( GolSimulation *handle, const char *name, int row, int col )
+{
+	try
+	{
+		return name && sim( handle )->loadFile( name, row, col );
+	}
+	catch( ... )
+	{
+		return 0;
+	}
+}
+
+/********************************************************************************
+*	Function: golSetCell( GolSimulation *, int, int, int ),
+*		golGetCell( const GolSimulation *, int, int )
+*	Description: Sets or returns one cell, 1 alive and 0 dead
+*	Parameters: The simulation, the row and column, and the state to set
+*	Pre-Conditions: None
+*	Post-Conditions: Cells off the board are ignored and read as 0. golSetCell
+*		returns 1, or 0 if the cell could not be set.
+* ******************************************************************************/
+int golSetCell( GolSimulation *handle, int r, int c, int alive )
+{
+	try
+	{
+		sim( handle )->setCell( r, c, alive != 0 );
+		return 1;
+	}
+	catch( ... )
+	{
+		return 0;
+	}
+}
+
+int golGetCell( const GolSimulation *handle, int r, int c )
+{
+	return sim( handle )->getCell( r, c );
+}
+
+/********************************************************************************
+*	Function: golClear( GolSimulation * ),
+*		golRandomize( GolSimulation *, uint64_t, double )
+*	Description: Empties the board, or fills it with a random soup, and starts
+*		again from generation 0
+*	Parameters: The simulation, and the seed and share of cells alive
+*	Pre-Conditions: None
+*	Post-Conditions: returns 1 once the board is replaced, or 0 if it could not
+*		be, as when the fill threads cannot be started
+* ******************************************************************************/
+int golClear( GolSimulation *handle )
+{
+	try
+	{
+		sim( handle )->clear();
+		return 1;
+	}
+	catch( ... )
+	{
+		return 0;
+	}
+}
+
+int golRandomize( GolSimulation *handle, uint64_t seed, double density )
+{
+	try
+	{
+		sim( handle )->randomize( seed, density );
+		return 1;
+	}
+	catch( ... )
+	{
+		return 0;
+	}
+}
+
+/********************************************************************************
+*	Function: golStep( GolSimulation *, int )
+*	Description: Advances the board a number of generations
+*	Parameters: The simulation and the number of generations
+*	Pre-Conditions: None
+*	Post-Conditions: returns 0 if the engine ran out of memory. Views taken
+*		before the call must be taken again.
+* ******************************************************************************/
+int golStep( GolSimulation *handle, int generations )
+{
+	try
+	{
+		sim( handle )->step( generations );
+		return 1;
+	}
+	catch( ... )
+	{
+		return 0;
+	}
+}
+
+/********************************************************************************
+*	Function: golWriteFrames( GolSimulation *, const char *, int ),
+*		golStopFrames( GolSimulation * )
+*	Description: Starts writing frames of the board, the board now and after
+*		every golStep, named by the prefix and generation; or writes every
+*		frame still waiting and stops
+*	Parameters: The simulation, and the file name prefix and the format,
+*		GOL_FRAME_RLE, GOL_FRAME_BINARY or GOL_FRAME_PGM
+*	Pre-Conditions: None
+*	Post-Conditions: golWriteFrames returns 0, writing no more frames, if the
+*		format is unknown or the first frame could not be written. golStopFrames
+*		returns 0 if any frame could not be written.
+* ******************************************************************************/
+int golWriteFrames( GolSimulation *handle, const char *prefix, int format )
+{
+	try
+	{
+		return prefix && sim( handle )->writeFrames( prefix, format );
+	}
+	catch( ... )
+	{
+		golStopFrames( handle );
+		return 0;
+	}
+}
+
+int golStopFrames( GolSimulation *handle )
+{
+	try
+	{
+		return sim( handle )->stopFrames();
+	}
+	catch( ... )
+	{
+		return 0;
+	}
+}
+
+/********************************************************************************
+*	Function: golGeneration(), golPopulation(), golStepSeconds(),
+*		golEngineName(), golRule()
+*	Description: Statistics: generations stepped, live cells, time spent
+*		stepping, and the names of the engine and rule
+*	Parameters: The simulation
+*	Pre-Conditions: None
+*	Post-Conditions: returns the statistic. Names are good until the engine or
+*		rule next changes.
+* ******************************************************************************/
+long long golGeneration( const GolSimulation *handle )
+{
+	return sim( handle )->getGeneration();
+}
+
+long long golPopulation( const GolSimulation *handle )
+{
+	return sim( handle )->getPopulation();
+}
+
+double golStepSeconds( const GolSimulation *handle )
+{
+	return sim( handle )->getStepSeconds();
+}
+
+const char *golEngineName( const GolSimulation *handle )
+{
+	return sim( handle )->getEngineName().c_str();
+}
+
+const char *golRule( const GolSimulation *handle )
+{
+	return sim( handle )->getRule().c_str();
+}
+
+/********************************************************************************
+*	Function: golView( const GolSimulation *, int *, int *, int * )
+*	Description: Returns the packed board without copying it
+*	Parameters: The simulation, and where to put the rows, columns and words in
+*		each row, any of which may be NULL
+*	Pre-Conditions: None
+*	Post-Conditions: returns the first word of the first row, NULL for an empty
+*		board, good until the next golStep
+* ******************************************************************************/
+const uint64_t *golView( const GolSimulation *handle, int *rows, int *cols, int *rowWords )
+{
+	GridView view = sim( handle )->view();
+
+	if( rows )
+		*rows = view.getRows();
+	if( cols )
+		*cols = view.getCols();
+	if( rowWords )
+		*rowWords = view.getRowWords();
+	return view.data();
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+ ** Program Filename: gol.h
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the C interface of the gol library, a thin wrapper
+			of the Simulation class for programs and languages that can call C
+			but not C++. A GolSimulation is an opaque handle made by golCreate
+			and freed by golDestroy. Functions that can fail return 1 on
+			success and 0 on failure, and no C++ exception crosses into the
+			caller. golView returns the packed board without copying it: rows
+			*rowWords words apart, bit j of word w of a row being column
+			w*64+j, good until the next golStep. golWriteFrames writes the
+			board after every golStep in the background, as RLE patterns,
+			binary frames or PGM images laid out as in writer.hpp. Engine and
+			rule names are as in simulation.hpp.
+ ** Input: None
+ ** Output: Frame files
+ * ***************************************************************************/
+#ifndef GOL_H
+#define GOL_H
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GOL_FRAME_RLE 0		//Run length encoded pattern, one .rle file per frame
+#define GOL_FRAME_BINARY 1	//Packed frames appended to one .frames file
+#define GOL_FRAME_PGM 2		//Binary greyscale image, one .pgm file per frame
+
+typedef struct GolSimulation GolSimulation;
+
+/********************************************************************************
+*	Function: golCreate( int, int, int ), golDestroy( GolSimulation * )
+*	Description: Creates an empty board stepped by the sweep under Life, and
+*		frees one
+*	Parameters: The rows and columns of the board, and the threads the parallel
+*		engines use, 0 for one per core; or the simulation to free
+*	Pre-Conditions: None
+*	Post-Conditions: golCreate returns NULL if the board cannot be allocated
+* ******************************************************************************/
+GolSimulation *golCreate( int, int, int );
+void golDestroy( GolSimulation * );
+
+/********************************************************************************
+*	Function: golSetEngine( GolSimulation *, const char * ),
+*		golSetRule( GolSimulation *, const char * )
+*	Description: Chooses the engine by name or sets the rule
+*	Parameters: The simulation and the name or rule
+*	Pre-Conditions: None
+*	Post-Conditions: returns 0 and changes nothing if the name or rule is refused
+* ******************************************************************************/
+int golSetEngine( GolSimulation *, const char * );
+int golSetRule( GolSimulation *, const char * );
+
+/********************************************************************************
+*	Function: golLoadPattern( GolSimulation *, const char *, int, int ),
+*		golLoadFile( GolSimulation *, const char *, int, int )
+*	Description: Adds an RLE or plaintext pattern, given as text or a file name
+*	Parameters: The simulation, the pattern or file, and the board row and column
+*		of the pattern's top left cell
+*	Pre-Conditions: None
+*	Post-Conditions: returns 0 and leaves the board unchanged if it cannot be
+*		loaded
+* ******************************************************************************/
+int golLoadPattern( GolSimulation *, const char *, int, int );
+int golLoadFile( GolSimulation *, const char *, int, int );
+
+/********************************************************************************
+*	Function: golSetCell( GolSimulation *, int, int, int ),
+*		golGetCell( const GolSimulation *, int, int )
+*	Description: Sets or returns one cell, 1 alive and 0 dead
+*	Parameters: The simulation, the row and column, and the state to set
+*	Pre-Conditions: None
+*	Post-Conditions: Cells off the board are ignored and read as 0. golSetCell
+*		returns 1, or 0 if the cell could not be set.
+* ******************************************************************************/
+int golSetCell( GolSimulation *, int, int, int );
+int golGetCell( const GolSimulation *, int, int );
+
+/********************************************************************************
+*	Function: golClear( GolSimulation * ),
+*		golRandomize( GolSimulation *, uint64_t, double )
+*	Description: Empties the board, or fills it with a random soup, and starts
+*		again from generation 0
+*	Parameters: The simulation, and the seed and share of cells alive
+*	Pre-Conditions: None
+*	Post-Conditions: returns 1 once the board is replaced, or 0 if it could not
+*		be, as when the fill threads cannot be started
+* ******************************************************************************/
+int golClear( GolSimulation * );
+int golRandomize( GolSimulation *, uint64_t, double );
+
+/********************************************************************************
+*	Function: golStep( GolSimulation *, int )
+*	Description: Advances the board a number of generations
+*	Parameters: The simulation and the number of generations
+*	Pre-Conditions: None
+*	Post-Conditions: returns 0 if the engine ran out of memory. Views taken
+*		before the call must be taken again.
+* ******************************************************************************/
+int golStep( GolSimulation *, int );
+
+/********************************************************************************
+*	Function: golWriteFrames( GolSimulation *, const char *, int ),
+*		golStopFrames( GolSimulation * )
+*	Description: Starts writing frames of the board, the board now and after
+*		every golStep, named by the prefix and generation; or writes every
+*		frame still waiting and stops
+*	Parameters: The simulation, and the file name prefix and the format,
+*		GOL_FRAME_RLE, GOL_FRAME_BINARY or GOL_FRAME_PGM
+*	Pre-Conditions: None
+*	Post-Conditions: golWriteFrames returns 0, writing no more frames, if the
+*		format is unknown or the first frame could not be written. golStopFrames
+*		returns 0 if any frame could not be written.
+* ******************************************************************************/
+int golWriteFrames( GolSimulation *, const char *, int );
+int golStopFrames( GolSimulation * );
+
+/********************************************************************************
+*	Function: golGeneration(), golPopulation(), golStepSeconds(),
+*		golEngineName(), golRule()
+*	Description: Statistics: generations stepped, live cells, time spent
+*		stepping, and the names of the engine and rule
+*	Parameters: The simulation
+*	Pre-Conditions: None
+*	Post-Conditions: returns the statistic. Names are good until the engine or
+*		rule next changes.
+* ******************************************************************************/
+long long golGeneration( const GolSimulation * );
+long long golPopulation( const GolSimulation * );
+double golStepSeconds( const GolSimulation * );
+const char *golEngineName( const GolSimulation * );
+const char *golRule( const GolSimulation * );
+
+/********************************************************************************
+*	Function: golView( const GolSimulation *, int *, int *, int * )
+*	Description: Returns the packed board without copying it
+*	Parameters: The simulation, and where to put the rows, columns and words in
+*		each row, any of which may be NULL
+*	Pre-Conditions: None
+*	Post-Conditions: returns the first word of the first row, NULL for an empty
+*		board, good until the next golStep
+* ******************************************************************************/
+const uint64_t *golView( const GolSimulation *, int *, int *, int * );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,324 @@
+/******************************************************************************
+ ** Program Filename: grid.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the Grid class function implementation file
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "grid.hpp"
+
+/********************************************************************************
+*	Function: allocate( int, int )
+*	Description: Allocates cache line aligned storage for a board of a size. The
+*		storage is not cleared.
+*	Parameters: The first int is the number of rows, the second the number of
+*		columns
+*	Pre-Conditions: bits must not hold storage
+*	Post-Conditions: the size members are set, bits points at the storage, and
+*		every tile is marked changed
+* ******************************************************************************/
+void Grid::allocate( int r, int c )
+{
+	rows = r < 0 ? 0 : r;
+	cols = c < 0 ? 0 : c;
+	rowWords = (cols + WORD_BITS - 1) / WORD_BITS;
+	lastMask = (cols % WORD_BITS) ? ((uint64_t)1 << (cols % WORD_BITS)) - 1 : ~(uint64_t)0;
+	bits = NULL;
+	changed.assign( (size_t)getTileRows() * rowWords, 1 );
+
+	size_t size = (size_t)rows * rowWords * sizeof(uint64_t);
+	if( size == 0 )
+		return;
+
+	void *mem = NULL;
+	if( posix_memalign( &mem, 64, size ) != 0 )
+		throw std::bad_alloc();
+	bits = static_cast<uint64_t *>( mem );
+}
+
+/********************************************************************************
+*	Function: release()
+*	Description: Frees the storage of the board
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: bits is NULL
+* ******************************************************************************/
+void Grid::release()
+{
+	free( bits );
+	bits = NULL;
+}
+
+/********************************************************************************
+*	Function: Grid()
+*	Description: Constructor of an empty 0 X 0 grid
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: The grid holds no cells
+* ******************************************************************************/
+Grid::Grid()
+{
+	allocate( 0, 0 );
+}
+
+/********************************************************************************
+*	Function: Grid( int, int )
+*	Description: Constructor of a grid with every cell dead
+*	Parameters: The first int is the number of rows, the second the number of
+*		columns
+*	Pre-Conditions: rows and columns should not be negative
+*	Post-Conditions: A rows X columns board is allocated and cleared
+* ******************************************************************************/
+Grid::Grid( int r, int c )
+{
+	allocate( r, c );
+	clear();
+}
+
+/********************************************************************************
+*	Function: Grid( const Grid & )
+*	Description: Copy constructor, copies the size and every cell of a grid
+*	Parameters: The grid to copy
+*	Pre-Conditions: None
+*	Post-Conditions: This grid holds the same cells as the one passed
+* ******************************************************************************/
+Grid::Grid( const Grid &other )
+{
+	allocate( other.rows, other.cols );
+	if( bits )
+		memcpy( bits, other.bits, bytes() );
+	changed = other.changed;
+}
+
+/********************************************************************************
+*	Function: operator=( const Grid & )
+*	Description: Copies the size and every cell of a grid into this grid
+*	Parameters: The grid to copy
+*	Pre-Conditions: None
+*	Post-Conditions: This grid holds the same cells as the one passed and every
+*		tile is marked changed
+* ******************************************************************************/
+Grid &Grid::operator=( const Grid &other )
+{
+	if( this == &other )
+		return *this;
+
+	if( other.rows != rows || other.cols != cols )
+	{
+		release();
+		allocate( other.rows, other.cols );
+	}
+	if( bits )
+		memcpy( bits, other.bits, bytes() );
+	changed.assign( changed.size(), 1 );
+	return *this;
+}
+
+Grid::~Grid()
+{
+	release();
+}
+
+/********************************************************************************
+*	Function: resize( int, int )
+*	Description: Reallocates the board to a new size with every cell dead
+*	Parameters: The first int is the number of rows, the second the number of
+*		columns
+*	Pre-Conditions: rows and columns should not be negative
+*	Post-Conditions: The board is the new size and cleared, every tile marked
+*		changed
+* ******************************************************************************/
+void Grid::resize( int r, int c )
+{
+	release();
+	allocate( r, c );
+	clear();
+}
+
+/********************************************************************************
+*	Function: resizeUntouched( int, int )
+*	Description: Reallocates the board to a new size without writing a cell, so
+*		each page of a large board is placed on the NUMA node of the first
+*		thread to write it
+*	Parameters: The first int is the number of rows, the second the number of
+*		columns
+*	Pre-Conditions: rows and columns should not be negative
+*	Post-Conditions: The board is the new size but its cells are undefined until
+*		written. Every tile is marked changed.
+* ******************************************************************************/
+void Grid::resizeUntouched( int r, int c )
+{
+	release();
+	allocate( r, c );
+}
+
+/********************************************************************************
+*	Function: swap( Grid & )
+*	Description: Exchanges the storage and size of two grids without copying.
+*		Between grids of the same size the change maps are not exchanged: each
+*		grid keeps the record of changes to the board it stands for. Between
+*		grids of different sizes they are, and every tile is marked changed.
+*	Parameters: The grid to swap with
+*	Pre-Conditions: None
+*	Post-Conditions: Each grid holds the cells the other held before
+* ******************************************************************************/
+void Grid::swap( Grid &other )
+{
+	uint64_t *tmpBits = bits; bits = other.bits; other.bits = tmpBits;
+	int tmp = rows; rows = other.rows; other.rows = tmp;
+	tmp = cols; cols = other.cols; other.cols = tmp;
+	tmp = rowWords; rowWords = other.rowWords; other.rowWords = tmp;
+	uint64_t tmpMask = lastMask; lastMask = other.lastMask; other.lastMask = tmpMask;
+
+	//A change map only fits a board of its own size
+	if( rows != other.rows || cols != other.cols )
+	{
+		changed.swap( other.changed );
+		changed.assign( changed.size(), 1 );
+		other.changed.assign( other.changed.size(), 1 );
+	}
+}
+
+/********************************************************************************
+*	Function: clear()
+*	Description: Sets every cell on the board to dead
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: Every word of the board is 0 and every tile is marked changed
+* ******************************************************************************/
+void Grid::clear()
+{
+	if( bits )
+		memset( bits, 0, bytes() );
+	changed.assign( changed.size(), 1 );
+}
+
+/********************************************************************************
+*	Function: clearChanged()
+*	Description: Forgets every change marked
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: No tile is marked
+* ******************************************************************************/
+void Grid::clearChanged()
+{
+	changed.assign( changed.size(), 0 );
+}
+
+/********************************************************************************
+*	Function: markAllChanged()
+*	Description: Marks every tile as changed, for callers that write the board
+*		through row() without marking what they wrote
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: Every tile is marked
+* ******************************************************************************/
+void Grid::markAllChanged()
+{
+	changed.assign( changed.size(), 1 );
+}
+
+/********************************************************************************
+*	Function: getCell( int, int )
+*	Description: Returns whether the cell at a row and column is alive.
+*		Cells outside the board are dead.
+*	Parameters: The first int is a row, the second a column
+*	Pre-Conditions: None
+*	Post-Conditions: returns true for a live cell
+* ******************************************************************************/
+bool Grid::getCell( int r, int c ) const
+{
+	if( r < 0 || r >= rows || c < 0 || c >= cols )
+		return false;
+	return ( row( r )[c / WORD_BITS] >> (c % WORD_BITS) ) & 1;
+}
+
+/********************************************************************************
+*	Function: setCell( int, int, bool )
+*	Description: Sets the cell at a row and column alive or dead. Cells outside
+*		the board are ignored.
+*	Parameters: The first int is a row, the second a column, the bool is true
+*		for a live cell
+*	Pre-Conditions: None
+*	Post-Conditions: The cell is updated and its tile marked changed
+* ******************************************************************************/
+void Grid::setCell( int r, int c, bool alive )
+{
+	if( r < 0 || r >= rows || c < 0 || c >= cols )
+		return;
+
+	markChanged( r, c / WORD_BITS );
+	uint64_t bit = (uint64_t)1 << (c % WORD_BITS);
+	if( alive )
+		row( r )[c / WORD_BITS] |= bit;
+	else
+		row( r )[c / WORD_BITS] &= ~bit;
+}
+
+/********************************************************************************
+*	Function: population()
+*	Description: Counts the live cells on the board
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns the number of live cells
+* ******************************************************************************/
+long long Grid::population() const
+{
+	long long count = 0;
+	size_t words = (size_t)rows * rowWords;
+
+	for( size_t i = 0; i < words; i++ )
+		count += __builtin_popcountll( bits[i] );
+	return count;
+}
+
+/********************************************************************************
+*	Function: sameCells( const Grid & )
+*	Description: Compares the size and every cell of two grids
+*	Parameters: The grid to compare with
+*	Pre-Conditions: None
+*	Post-Conditions: returns true when both grids hold the same board
+* ******************************************************************************/
+bool Grid::sameCells( const Grid &other ) const
+{
+	if( rows != other.rows || cols != other.cols )
+		return false;
+	return bytes() == 0 || memcmp( bits, other.bits, bytes() ) == 0;
+}
+
+/********************************************************************************
+*	Function: loadWorld( char[ROW][COL], int, int )
+*	Description: Copies a World array into the board with its top left corner
+*		at a row and column. '0' cells are alive, anything else is dead, and
+*		cells falling outside the board are dropped.
+*	Parameters: A character array of the world. The first int is a row and the
+*		second a column of the board
+*	Pre-Conditions: A valid character array must be passed
+*	Post-Conditions: The covered part of the board matches the array
+* ******************************************************************************/
+void Grid::loadWorld( char world[ROW][COL], int rowVar, int colVar )
+{
+	for( int i = 0; i < ROW; i++ )
+		for( int j = 0; j < COL; j++ )
+			setCell( rowVar + i, colVar + j, world[i][j] == '0' );
+}
+
+/********************************************************************************
+*	Function: storeWorld( char[ROW][COL], int, int )
+*	Description: Copies the part of the board with its top left corner at a row
+*		and column into a World array as '0' and '.' cells
+*	Parameters: A character array of the world. The first int is a row and the
+*		second a column of the board
+*	Pre-Conditions: A valid character array must be passed
+*	Post-Conditions: The array matches the covered part of the board
+* ******************************************************************************/
+void Grid::storeWorld( char world[ROW][COL], int rowVar, int colVar ) const
+{
+	for( int i = 0; i < ROW; i++ )
+		for( int j = 0; j < COL; j++ )
+			world[i][j] = getCell( rowVar + i, colVar + j ) ? '0' : '.';
+}
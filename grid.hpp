@@ -0,0 +1,283 @@
+/******************************************************************************
+ ** Program Filename: grid.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the Grid class. A Grid is a board
+			of any size where each cell is stored as one bit. Every row is
+			packed into 64 bit words, bit j of word w being column w*64+j, and
+			rows are padded to a whole number of words. Cells outside the
+			board are always dead. It has functions to get and set cells,
+			clear the board, count the population, and copy a World array in
+			and out of the board. The board is also cut into tiles of
+			TILE_ROWS rows by one word, and a change map records which tiles
+			have changed since clearChanged() so a viewer only has to look at
+			those. Engines mark the tiles they change.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef GRID_HPP
+#define GRID_HPP
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+#include "world.hpp"
+
+#define WORD_BITS 64   //Number of cells packed into one word of a row
+#define TILE_ROWS 64   //Rows in a tile of the change map, which is one word wide
+
+//Grid Class Declaration
+class Grid
+{
+	private:
+		uint64_t *bits;   //Bit-packed cells, rows are rowWords apart
+		int rows;		  //Number of rows on the board
+		int cols;		  //Number of columns on the board
+		int rowWords;	  //Number of words in each packed row
+		uint64_t lastMask; //Mask of the valid bits in the last word of a row
+		std::vector<unsigned char> changed; //Flag for each tile changed, row by row
+
+		void allocate( int, int );
+		void release();
+
+	public:
+		/********************************************************************************
+		*	Function: Grid()
+		*	Description: Constructor of an empty 0 X 0 grid
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: The grid holds no cells
+		* ******************************************************************************/
+		Grid();
+
+		/********************************************************************************
+		*	Function: Grid( int, int )
+		*	Description: Constructor of a grid with every cell dead
+		*	Parameters: The first int is the number of rows, the second the number of
+		*		columns
+		*	Pre-Conditions: rows and columns should not be negative
+		*	Post-Conditions: A rows X columns board is allocated and cleared
+		* ******************************************************************************/
+		Grid( int, int );
+
+		/********************************************************************************
+		*	Function: Grid( const Grid & )
+		*	Description: Copy constructor, copies the size and every cell of a grid
+		*	Parameters: The grid to copy
+		*	Pre-Conditions: None
+		*	Post-Conditions: This grid holds the same cells as the one passed
+		* ******************************************************************************/
+		Grid( const Grid & );
+
+		/********************************************************************************
+		*	Function: operator=( const Grid & )
+		*	Description: Copies the size and every cell of a grid into this grid
+		*	Parameters: The grid to copy
+		*	Pre-Conditions: None
+		*	Post-Conditions: This grid holds the same cells as the one passed and every
+		*		tile is marked changed
+		* ******************************************************************************/
+		Grid &operator=( const Grid & );
+
+		~Grid();
+
+		/********************************************************************************
+		*	Function: resize( int, int )
+		*	Description: Reallocates the board to a new size with every cell dead
+		*	Parameters: The first int is the number of rows, the second the number of
+		*		columns
+		*	Pre-Conditions: rows and columns should not be negative
+		*	Post-Conditions: The board is the new size and cleared, every tile marked
+		*		changed
+		* ******************************************************************************/
+		void resize( int, int );
+
+		/********************************************************************************
+		*	Function: resizeUntouched( int, int )
+		*	Description: Reallocates the board to a new size without writing a cell, so
+		*		each page of a large board is placed on the NUMA node of the first
+		*		thread to write it
+		*	Parameters: The first int is the number of rows, the second the number of
+		*		columns
+		*	Pre-Conditions: rows and columns should not be negative
+		*	Post-Conditions: The board is the new size but its cells are undefined until
+		*		written. Every tile is marked changed.
+		* ******************************************************************************/
+		void resizeUntouched( int, int );
+
+		/********************************************************************************
+		*	Function: swap( Grid & )
+		*	Description: Exchanges the storage and size of two grids without copying.
+		*		Between grids of the same size the change maps are not exchanged: each
+		*		grid keeps the record of changes to the board it stands for. Between
+		*		grids of different sizes they are, and every tile is marked changed.
+		*	Parameters: The grid to swap with
+		*	Pre-Conditions: None
+		*	Post-Conditions: Each grid holds the cells the other held before
+		* ******************************************************************************/
+		void swap( Grid & );
+
+		/********************************************************************************
+		*	Function: clear()
+		*	Description: Sets every cell on the board to dead
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: Every word of the board is 0 and every tile is marked changed
+		* ******************************************************************************/
+		void clear();
+
+		/********************************************************************************
+		*	Function: markChanged( int, int )
+		*	Description: Marks the tile holding a row and word as changed
+		*	Parameters: The first int is a row, the second a word of the row
+		*	Pre-Conditions: The row and word must be within the board
+		*	Post-Conditions: The tile is marked
+		* ******************************************************************************/
+		void markChanged( int r, int w )
+		{ changed[(size_t)(r / TILE_ROWS) * rowWords + w] = 1; }
+
+		/********************************************************************************
+		*	Function: isChanged( int, int )
+		*	Description: Returns whether a tile has changed since clearChanged()
+		*	Parameters: The first int is a tile row (a row / TILE_ROWS), the second a word
+		*	Pre-Conditions: The tile must be within the board
+		*	Post-Conditions: returns true if the tile was marked
+		* ******************************************************************************/
+		bool isChanged( int tr, int w ) const
+		{ return changed[(size_t)tr * rowWords + w] != 0; }
+
+		/********************************************************************************
+		*	Function: clearChanged()
+		*	Description: Forgets every change marked
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: No tile is marked
+		* ******************************************************************************/
+		void clearChanged();
+
+		/********************************************************************************
+		*	Function: markAllChanged()
+		*	Description: Marks every tile as changed, for callers that write the board
+		*		through row() without marking what they wrote
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: Every tile is marked
+		* ******************************************************************************/
+		void markAllChanged();
+
+		/********************************************************************************
+		*	Function: getTileRows()
+		*	Description: Returns the number of rows of tiles in the change map
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns rows / TILE_ROWS rounded up
+		* ******************************************************************************/
+		int getTileRows() const
+		{ return (rows + TILE_ROWS - 1) / TILE_ROWS; }
+
+		/********************************************************************************
+		*	Function: getCell( int, int )
+		*	Description: Returns whether the cell at a row and column is alive.
+		*		Cells outside the board are dead.
+		*	Parameters: The first int is a row, the second a column
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns true for a live cell
+		* ******************************************************************************/
+		bool getCell( int, int ) const;
+
+		/********************************************************************************
+		*	Function: setCell( int, int, bool )
+		*	Description: Sets the cell at a row and column alive or dead. Cells outside
+		*		the board are ignored.
+		*	Parameters: The first int is a row, the second a column, the bool is true
+		*		for a live cell
+		*	Pre-Conditions: None
+		*	Post-Conditions: The cell is updated and its tile marked changed
+		* ******************************************************************************/
+		void setCell( int, int, bool );
+
+		/********************************************************************************
+		*	Function: population()
+		*	Description: Counts the live cells on the board
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the number of live cells
+		* ******************************************************************************/
+		long long population() const;
+
+		/********************************************************************************
+		*	Function: sameCells( const Grid & )
+		*	Description: Compares the size and every cell of two grids
+		*	Parameters: The grid to compare with
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns true when both grids hold the same board
+		* ******************************************************************************/
+		bool sameCells( const Grid & ) const;
+
+		/********************************************************************************
+		*	Function: loadWorld( char[ROW][COL], int, int )
+		*	Description: Copies a World array into the board with its top left corner
+		*		at a row and column. '0' cells are alive, anything else is dead, and
+		*		cells falling outside the board are dropped.
+		*	Parameters: A character array of the world. The first int is a row and the
+		*		second a column of the board
+		*	Pre-Conditions: A valid character array must be passed
+		*	Post-Conditions: The covered part of the board matches the array
+		* ******************************************************************************/
+		void loadWorld( char[ROW][COL], int, int );
+
+		/********************************************************************************
+		*	Function: storeWorld( char[ROW][COL], int, int )
+		*	Description: Copies the part of the board with its top left corner at a row
+		*		and column into a World array as '0' and '.' cells
+		*	Parameters: A character array of the world. The first int is a row and the
+		*		second a column of the board
+		*	Pre-Conditions: A valid character array must be passed
+		*	Post-Conditions: The array matches the covered part of the board
+		* ******************************************************************************/
+		void storeWorld( char[ROW][COL], int, int ) const;
+
+		/********************************************************************************
+		*	Function: row( int )
+		*	Description: Returns the packed words of a row
+		*	Parameters: int representing a row
+		*	Pre-Conditions: the row must be within the board
+		*	Post-Conditions: returns a pointer to the first of rowWords words
+		* ******************************************************************************/
+		uint64_t *row( int r )
+		{ return bits + (size_t)r * rowWords; }
+
+		const uint64_t *row( int r ) const
+		{ return bits + (size_t)r * rowWords; }
+
+		int getRows() const
+		{ return rows; }
+
+		int getCols() const
+		{ return cols; }
+
+		int getRowWords() const
+		{ return rowWords; }
+
+		/********************************************************************************
+		*	Function: getLastMask()
+		*	Description: Returns the mask of the bits of the last word in a row that are
+		*		on the board. Engines must AND it into the last word they write.
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the mask
+		* ******************************************************************************/
+		uint64_t getLastMask() const
+		{ return lastMask; }
+
+		/********************************************************************************
+		*	Function: bytes()
+		*	Description: Returns the size of the packed board in bytes
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns rows * rowWords * 8
+		* ******************************************************************************/
+		size_t bytes() const
+		{ return (size_t)rows * rowWords * sizeof(uint64_t); }
+};
+
+#endif
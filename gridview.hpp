@@ -0,0 +1,95 @@
+/******************************************************************************
+ ** Program Filename: gridview.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the GridView class. A GridView
+			is a read-only window onto the packed rows of a Grid: a pointer to
+			the first word and the board's dimensions, laid out as in a Grid,
+			bit j of word w of a row being column w*64+j and rows rowWords
+			words apart. Taking a view copies nothing, so a host can inspect
+			every generation without copying the board. Engines swap a board's
+			storage as they step, so a view is only good until the board is
+			next stepped or resized, and should be taken again after that.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef GRIDVIEW_HPP
+#define GRIDVIEW_HPP
+#include "grid.hpp"
+
+//GridView Class Declaration
+class GridView
+{
+	private:
+		const uint64_t *bits;	//First word of the first row, NULL if empty
+		int rows;				//Number of rows on the board
+		int cols;				//Number of columns on the board
+		int rowWords;			//Number of words in each packed row
+
+	public:
+		/********************************************************************************
+		*	Function: GridView()
+		*	Description: Constructor of a view of no board
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: The view holds no cells
+		* ******************************************************************************/
+		GridView()
+		{ bits = NULL; rows = 0; cols = 0; rowWords = 0; }
+
+		/********************************************************************************
+		*	Function: GridView( const Grid & )
+		*	Description: Constructor of a view of a board's current storage
+		*	Parameters: The board
+		*	Pre-Conditions: None
+		*	Post-Conditions: The view reads the board until it is stepped or resized
+		* ******************************************************************************/
+		GridView( const Grid &grid )
+		{
+			rows = grid.getRows();
+			cols = grid.getCols();
+			rowWords = grid.getRowWords();
+			bits = rows > 0 && rowWords > 0 ? grid.row( 0 ) : NULL;
+		}
+
+		/********************************************************************************
+		*	Function: row( int )
+		*	Description: Returns the packed words of a row
+		*	Parameters: int representing a row
+		*	Pre-Conditions: the row must be within the board
+		*	Post-Conditions: returns a pointer to the first of rowWords words
+		* ******************************************************************************/
+		const uint64_t *row( int r ) const
+		{ return bits + (size_t)r * rowWords; }
+
+		/********************************************************************************
+		*	Function: getCell( int, int )
+		*	Description: Returns whether a cell is alive
+		*	Parameters: The row and column of the cell
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false for cells off the board
+		* ******************************************************************************/
+		bool getCell( int r, int c ) const
+		{
+			if( r < 0 || c < 0 || r >= rows || c >= cols )
+				return false;
+			return (row( r )[c / WORD_BITS] >> (c % WORD_BITS)) & 1;
+		}
+
+		const uint64_t *data() const
+		{ return bits; }
+
+		int getRows() const
+		{ return rows; }
+
+		int getCols() const
+		{ return cols; }
+
+		int getRowWords() const
+		{ return rowWords; }
+
+		size_t words() const
+		{ return (size_t)rows * rowWords; }
+};
+
+#endif
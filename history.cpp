@@ -0,0 +1,357 @@
+/******************************************************************************
+ ** Program Filename: history.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the History class function implementation file
+ ** Input: Frames spilled to the spill file
+ ** Output: Frames spilled to the spill file
+ * ***************************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include "history.hpp"
+
+/********************************************************************************
+*	Function: putCount( std::vector<unsigned char> &, uint64_t )
+*	Description: Appends a count to a frame, 7 bits per byte with the high bit
+*		set on every byte but the last
+*	Parameters: The frame and the count
+*	Pre-Conditions: None
+*	Post-Conditions: The count is appended
+* ******************************************************************************/
+static void putCount( std::vector<unsigned char> &out, uint64_t count )
+{
+	while( count >= 0x80 )
+	{
+		out.push_back( (unsigned char)(count | 0x80) );
+		count >>= 7;
+	}
+	out.push_back( (unsigned char)count );
+}
+
+/********************************************************************************
+*	Function: getCount( const unsigned char *&, const unsigned char *, uint64_t & )
+*	Description: Reads a count written by putCount() and moves past it
+*	Parameters: The read position, the end of the frame, and the count read
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the frame ends inside the count
+* ******************************************************************************/
+static bool getCount( const unsigned char *&pos, const unsigned char *end, uint64_t &count )
+{
+	count = 0;
+	for( int shift = 0; pos < end && shift < 64; shift += 7 )
+	{
+		unsigned char byte = *pos++;
+		count |= (uint64_t)(byte & 0x7f) << shift;
+		if( !(byte & 0x80) )
+			return true;
+	}
+	return false;
+}
+
+/********************************************************************************
+*	Function: History( size_t, int, const char * )
+*	Description: Constructor of an empty history
+*	Parameters: The bytes of frames to keep in memory (0 keeps up to twice the
+*		size of the board), the generations between keyframes, and the path of
+*		the spill file, or NULL for a file of unique name made in $TMPDIR (or
+*		/tmp) when frames are first spilled
+*	Pre-Conditions: None
+*	Post-Conditions: No generations are recorded
+* ******************************************************************************/
+History::History( size_t memoryBudget, int interval, const char *path )
+{
+	budget = memoryBudget;
+	keyInterval = interval < 1 ? 1 : interval;
+	tempSpill = path == NULL;
+	if( path )
+		spillPath = path;
+	frames = 0;
+	spilled = 0;
+	residentBytes = 0;
+	offsets.push_back( 0 );
+}
+
+/********************************************************************************
+*	Function: ~History()
+*	Description: Destructor, closes and removes the spill file
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: The spill file is deleted
+* ******************************************************************************/
+History::~History()
+{
+	if( spill.is_open() )
+	{
+		spill.close();
+		std::remove( spillPath.c_str() );
+	}
+}
+
+/********************************************************************************
+*	Function: clear()
+*	Description: Forgets every recorded generation
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: No generations are recorded and the spill file is emptied
+* ******************************************************************************/
+void History::clear()
+{
+	if( spill.is_open() )
+	{
+		spill.close();
+		std::remove( spillPath.c_str() );
+	}
+	if( tempSpill )
+		spillPath.clear();
+	last.resize( 0, 0 );
+	frames = 0;
+	spilled = 0;
+	offsets.assign( 1, 0 );
+	resident.clear();
+	residentBytes = 0;
+}
+
+/********************************************************************************
+*	Function: encode( const uint64_t *, const uint64_t *, size_t,
+*		std::vector<unsigned char> & )
+*	Description: Run-length encodes the bytes of a board, or of its XOR with a
+*		base board, as pairs of runs: a count of zero bytes, then a count of
+*		other bytes followed by those bytes. Zero runs shorter than
+*		HISTORY_MIN_RUN stay inside the literal run, where they are cheaper.
+*	Parameters: The words of the board, the words of the base board or NULL,
+*		the number of words, and the frame to write
+*	Pre-Conditions: Both boards hold the number of words
+*	Post-Conditions: The frame holds the encoded bytes
+* ******************************************************************************/
+void History::encode( const uint64_t *cur, const uint64_t *base, size_t words,
+		std::vector<unsigned char> &out )
+{
+	const unsigned char *bytes = reinterpret_cast<const unsigned char *>( cur );
+	size_t total = words * sizeof(uint64_t);
+
+	if( base )
+	{
+		work.resize( words );
+		for( size_t i = 0; i < words; i++ )
+			work[i] = cur[i] ^ base[i];
+		bytes = reinterpret_cast<const unsigned char *>( words ? &work[0] : NULL );
+	}
+
+	out.clear();
+	size_t i = 0;
+	while( i < total )
+	{
+		size_t start = i;
+		while( i < total && bytes[i] == 0 )
+			i++;
+		putCount( out, i - start );
+
+		//The literal run ends at the first zero run long enough to be worth
+		//	its own count
+		start = i;
+		size_t zeros = 0;
+		while( i < total && zeros < HISTORY_MIN_RUN )
+		{
+			zeros = bytes[i] == 0 ? zeros + 1 : 0;
+			i++;
+		}
+		if( zeros == HISTORY_MIN_RUN )
+			i -= zeros;
+		putCount( out, i - start );
+		out.insert( out.end(), bytes + start, bytes + i );
+	}
+}
+
+/********************************************************************************
+*	Function: decode( const std::vector<unsigned char> &, Grid &, bool )
+*	Description: Decodes a frame written by encode() into a board
+*	Parameters: The frame, the board, and true to XOR the frame into the board
+*		(a delta) or false to overwrite the board (a keyframe)
+*	Pre-Conditions: The board is the size of the recorded boards
+*	Post-Conditions: returns false if the frame does not fit the board
+* ******************************************************************************/
+bool History::decode( const std::vector<unsigned char> &frame, Grid &grid, bool delta )
+{
+	const unsigned char *pos = frame.empty() ? NULL : &frame[0];
+	const unsigned char *end = pos + frame.size();
+	unsigned char *bytes = reinterpret_cast<unsigned char *>( grid.row( 0 ) );
+	size_t total = grid.bytes();
+	size_t i = 0;
+
+	while( i < total )
+	{
+		uint64_t zeros, literals;
+		if( !getCount( pos, end, zeros ) || zeros > total - i )
+			return false;
+		if( !delta )
+			memset( bytes + i, 0, zeros );
+		i += zeros;
+
+		if( !getCount( pos, end, literals ) || literals > total - i ||
+				literals > (uint64_t)(end - pos) )
+			return false;
+		if( delta )
+			for( uint64_t j = 0; j < literals; j++ )
+				bytes[i+j] ^= pos[j];
+		else
+			memcpy( bytes + i, pos, literals );
+		i += literals;
+		pos += literals;
+	}
+	return pos == end;
+}
+
+/********************************************************************************
+*	Function: loadFrame( long long )
+*	Description: Finds a recorded frame in memory or reads it back from disk
+*	Parameters: The generation of the frame
+*	Pre-Conditions: The generation was recorded
+*	Post-Conditions: returns the frame, or NULL if it could not be read
+* ******************************************************************************/
+const std::vector<unsigned char> *History::loadFrame( long long generation )
+{
+	if( generation >= spilled )
+		return &resident[generation - spilled];
+
+	uint64_t size = offsets[generation + 1] - offsets[generation];
+	scratch.resize( size );
+	spill.clear();
+	spill.seekg( offsets[generation] );
+	if( size > 0 )
+		spill.read( reinterpret_cast<char *>( &scratch[0] ), size );
+	return spill ? &scratch : NULL;
+}
+
+/********************************************************************************
+*	Function: openSpill()
+*	Description: Opens the spill file empty. Without a path given, a file of
+*		unique name is made in $TMPDIR, or /tmp, so histories never share one.
+*	Parameters: None
+*	Pre-Conditions: The spill file is not open
+*	Post-Conditions: returns false if the file could not be made or opened
+* ******************************************************************************/
+bool History::openSpill()
+{
+	if( tempSpill )
+	{
+		const char *dir = std::getenv( "TMPDIR" );
+		std::string name = std::string( dir && *dir ? dir : "/tmp" ) + "/" + HISTORY_SPILL;
+		std::vector<char> buffer( name.begin(), name.end() );
+		buffer.push_back( '\0' );
+
+		int fd = mkstemp( &buffer[0] );
+		if( fd < 0 )
+			return false;
+		close( fd );
+		spillPath = &buffer[0];
+	}
+
+	spill.open( spillPath.c_str(), std::ios::in | std::ios::out |
+			std::ios::binary | std::ios::trunc );
+	if( !spill.is_open() && tempSpill )
+	{
+		std::remove( spillPath.c_str() );
+		spillPath.clear();
+	}
+	return spill.is_open();
+}
+
+/********************************************************************************
+*	Function: spillFrames()
+*	Description: Writes the oldest frames in memory to the spill file until the
+*		frames left in memory fit the budget
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the spill file could not be written
+* ******************************************************************************/
+bool History::spillFrames()
+{
+	size_t limit = budget ? budget : 2 * last.bytes();
+
+	while( residentBytes > limit && !resident.empty() )
+	{
+		if( !spill.is_open() && !openSpill() )
+			return false;
+
+		std::vector<unsigned char> &frame = resident.front();
+		spill.clear();
+		spill.seekp( offsets.back() );
+		if( !frame.empty() )
+			spill.write( reinterpret_cast<const char *>( &frame[0] ), frame.size() );
+		if( !spill )
+			return false;
+
+		offsets.push_back( offsets.back() + frame.size() );
+		residentBytes -= frame.size();
+		resident.pop_front();
+		spilled++;
+	}
+	return true;
+}
+
+/********************************************************************************
+*	Function: record( const Grid & )
+*	Description: Records a board as the next generation. The first generation
+*		recorded fixes the size of the board.
+*	Parameters: The board
+*	Pre-Conditions: None
+*	Post-Conditions: returns false, recording nothing, if the board is not the
+*		size of the ones recorded before. Also returns false if frames could not
+*		be spilled to disk, in which case they stay in memory.
+* ******************************************************************************/
+bool History::record( const Grid &grid )
+{
+	if( frames > 0 && ( grid.getRows() != last.getRows() ||
+			grid.getCols() != last.getCols() ) )
+		return false;
+
+	size_t words = (size_t)grid.getRows() * grid.getRowWords();
+	bool key = frames % keyInterval == 0;
+
+	resident.push_back( std::vector<unsigned char>() );
+	encode( grid.row( 0 ), key || frames == 0 ? NULL : last.row( 0 ), words,
+			resident.back() );
+	residentBytes += resident.back().size();
+	last = grid;
+	frames++;
+
+	return spillFrames();
+}
+
+/********************************************************************************
+*	Function: seek( long long, Grid & )
+*	Description: Rebuilds a recorded generation
+*	Parameters: The generation, counting the first recorded as 0, and the grid
+*		to rebuild it in
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the generation was not recorded or could
+*		not be read back, otherwise the grid holds that generation
+* ******************************************************************************/
+bool History::seek( long long generation, Grid &grid )
+{
+	if( generation < 0 || generation >= frames )
+		return false;
+
+	if( generation == frames - 1 )
+	{
+		grid = last;
+		return true;
+	}
+
+	if( grid.getRows() != last.getRows() || grid.getCols() != last.getCols() )
+		grid.resize( last.getRows(), last.getCols() );
+	else
+		grid.markAllChanged();	//decode() writes the bytes without marking tiles
+
+	//Decode the nearest keyframe at or before the generation, then replay
+	//	the deltas up to it
+	for( long long g = generation - generation % keyInterval; g <= generation; g++ )
+	{
+		const std::vector<unsigned char> *frame = loadFrame( g );
+		if( !frame || !decode( *frame, grid, g % keyInterval != 0 ) )
+			return false;
+	}
+	return true;
+}
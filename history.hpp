@@ -0,0 +1,127 @@
+/******************************************************************************
+ ** Program Filename: history.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the History class. It records
+			every generation of a Grid so any past generation can be rebuilt.
+			Every keyInterval-th generation is kept whole as a keyframe and the
+			generations between keep only the XOR of the board with the one
+			before, which is mostly zero bytes. Each frame is run-length
+			encoded by bytes. Frames live in memory up to a byte budget, and
+			the oldest are then spilled to a file on disk, so memory stays near
+			one board plus the budget however many generations are recorded.
+			seek() rebuilds a generation by decoding the keyframe at or before
+			it and replaying the deltas after it.
+ ** Input: Frames spilled to the spill file
+ ** Output: Frames spilled to the spill file
+ * ***************************************************************************/
+#ifndef HISTORY_HPP
+#define HISTORY_HPP
+#include <deque>
+#include <vector>
+#include <string>
+#include <fstream>
+#include "grid.hpp"
+
+#define HISTORY_KEY_INTERVAL 64		   //Default generations between keyframes
+#define HISTORY_SPILL "gol-history-XXXXXX" //Name of a spill file made in $TMPDIR
+#define HISTORY_MIN_RUN 3				   //Shortest zero run encoded as a run
+
+//History Class Declaration
+class History
+{
+	private:
+		int keyInterval;		//Generations from one keyframe to the next
+		size_t budget;			//Bytes of frames kept in memory, 0 for twice a board
+		std::string spillPath;	//File the oldest frames are written to
+		bool tempSpill;			//Whether the spill file is made fresh in $TMPDIR
+		std::fstream spill;		//Open spill file
+		Grid last;				//Last generation recorded, the base of the next delta
+		long long frames;		//Number of generations recorded
+		long long spilled;		//Number of oldest frames on disk
+		std::vector<uint64_t> offsets;  //Spill file offset of each spilled frame, and the end
+		std::deque< std::vector<unsigned char> > resident; //Frames not spilled, oldest first
+		size_t residentBytes;	//Bytes of encoded frames in memory
+		std::vector<unsigned char> scratch; //Frame read back from disk
+		std::vector<uint64_t> work;	//XOR of a board with the last one
+
+		void encode( const uint64_t *, const uint64_t *, size_t,
+				std::vector<unsigned char> & );
+		bool decode( const std::vector<unsigned char> &, Grid &, bool );
+		const std::vector<unsigned char> *loadFrame( long long );
+		bool openSpill();
+		bool spillFrames();
+
+	public:
+		/********************************************************************************
+		*	Function: History( size_t, int, const char * )
+		*	Description: Constructor of an empty history
+		*	Parameters: The bytes of frames to keep in memory (0 keeps up to twice the
+		*		size of the board), the generations between keyframes, and the path of
+		*		the spill file, or NULL for a file of unique name made in $TMPDIR (or
+		*		/tmp) when frames are first spilled
+		*	Pre-Conditions: None
+		*	Post-Conditions: No generations are recorded
+		* ******************************************************************************/
+		History( size_t = 0, int = HISTORY_KEY_INTERVAL, const char * = NULL );
+
+		/********************************************************************************
+		*	Function: ~History()
+		*	Description: Destructor, closes and removes the spill file
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: The spill file is deleted
+		* ******************************************************************************/
+		~History();
+
+		/********************************************************************************
+		*	Function: clear()
+		*	Description: Forgets every recorded generation
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: No generations are recorded and the spill file is emptied
+		* ******************************************************************************/
+		void clear();
+
+		/********************************************************************************
+		*	Function: record( const Grid & )
+		*	Description: Records a board as the next generation. The first generation
+		*		recorded fixes the size of the board.
+		*	Parameters: The board
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false, recording nothing, if the board is not the
+		*		size of the ones recorded before. Also returns false if frames could not
+		*		be spilled to disk, in which case they stay in memory.
+		* ******************************************************************************/
+		bool record( const Grid & );
+
+		/********************************************************************************
+		*	Function: seek( long long, Grid & )
+		*	Description: Rebuilds a recorded generation
+		*	Parameters: The generation, counting the first recorded as 0, and the grid
+		*		to rebuild it in
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false if the generation was not recorded or could
+		*		not be read back, otherwise the grid holds that generation. Every tile
+		*		of the grid is marked changed.
+		* ******************************************************************************/
+		bool seek( long long, Grid & );
+
+		long long getFrames() const
+		{ return frames; }
+
+		size_t getMemoryBytes() const
+		{ return residentBytes; }
+
+		/********************************************************************************
+		*	Function: getDiskBytes()
+		*	Description: Returns the bytes of frames spilled to disk
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the size of the spill file
+		* ******************************************************************************/
+		uint64_t getDiskBytes() const
+		{ return offsets.empty() ? 0 : offsets.back(); }
+};
+
+#endif
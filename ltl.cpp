@@ -0,0 +1,436 @@
+/******************************************************************************
+ ** Program Filename: ltl.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the LtlEngine class function implementation file
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+#include "ltl.hpp"
+
+/********************************************************************************
+*	Function: parseNumber( const std::string &, int & )
+*	Description: Parses a count or radius of a rule
+*	Parameters: The digits and the number to fill
+*	Pre-Conditions: None
+*	Post-Conditions: returns false unless the string is 1-7 digits
+* ******************************************************************************/
+static bool parseNumber( const std::string &digits, int &number )
+{
+	if( digits.empty() || digits.size() > 7 )
+		return false;
+	for( size_t i = 0; i < digits.size(); i++ )
+		if( !isdigit( (unsigned char)digits[i] ) )
+			return false;
+	number = atoi( digits.c_str() );
+	return true;
+}
+
+/********************************************************************************
+*	Function: parseRange( const std::string &, int &, int & )
+*	Description: Parses a range of counts such as "34..58", or a single count
+*	Parameters: The text and the lowest and highest counts to fill
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the text is not a range
+* ******************************************************************************/
+static bool parseRange( const std::string &text, int &low, int &high )
+{
+	size_t dots = text.find( ".." );
+
+	if( dots == std::string::npos )
+	{
+		if( !parseNumber( text, low ) )
+			return false;
+		high = low;
+		return true;
+	}
+	return parseNumber( text.substr( 0, dots ), low )
+			&& parseNumber( text.substr( dots + 2 ), high ) && low <= high;
+}
+
+/********************************************************************************
+*	Function: addRow( const uint64_t *, int, unsigned short *, int )
+*	Description: Adds or subtracts the live cells of a packed row to the column
+*		sums, one live cell at a time, so empty words cost one test
+*	Parameters: The row, its words, the sum of column 0, and +1 or -1
+*	Pre-Conditions: sums holds a sum for every column of the row
+*	Post-Conditions: Each live cell's column sum is changed by delta
+* ******************************************************************************/
+static void addRow( const uint64_t *row, int words, unsigned short *sums, int delta )
+{
+	for( int w = 0; w < words; w++ )
+	{
+		uint64_t bits = row[w];
+		unsigned short *word = sums + w * WORD_BITS;
+
+		while( bits )
+		{
+			word[__builtin_ctzll( bits )] += delta;
+			bits &= bits - 1;
+		}
+	}
+}
+
+/********************************************************************************
+*	Function: LtlEngine( int )
+*	Description: Constructor of a Larger-than-Life engine running Bosco's rule
+*	Parameters: The number of threads, 0 for one per core
+*	Pre-Conditions: None
+*	Post-Conditions: The engine is ready to advance grids
+* ******************************************************************************/
+LtlEngine::LtlEngine( int count )
+{
+	threads = count > 0 ? count : (int)std::thread::hardware_concurrency();
+	if( threads < 1 )
+		threads = 1;
+	round = 0;
+	pending = 0;
+	active = 0;
+	stopping = false;
+	target = NULL;
+	setRule( LTL_BOSCO );
+}
+
+/********************************************************************************
+*	Function: ~LtlEngine()
+*	Description: Destructor, stops and joins the helper threads
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: No helper is running
+* ******************************************************************************/
+LtlEngine::~LtlEngine()
+{
+	{
+		std::lock_guard<std::mutex> hold( lock );
+		stopping = true;
+	}
+	wake.notify_all();
+	for( size_t t = 0; t < helpers.size(); t++ )
+		helpers[t].join();
+}
+
+/********************************************************************************
+*	Function: setRule( const std::string & )
+*	Description: Parses and sets a rule in Golly's "Rr,Cc,Mm,Sa..b,Bc..d,Nn"
+*		form, the parts in any order. C and N may be left out. A single count
+*		such as "B3" is a range of one.
+*	Parameters: The rule string
+*	Pre-Conditions: None
+*	Post-Conditions: returns false and leaves the rule unchanged if the string
+*		is not a rule this engine runs: R must be 1-LTL_MAX_RADIUS, C 0 or 2
+*		(two states), N M (the square), and the ranges within the square
+* ******************************************************************************/
+bool LtlEngine::setRule( const std::string &rule )
+{
+	std::istringstream in( rule );
+	std::string part;
+	int newRadius = 0, newMiddle = 0, states = 0;
+	int sLow = 0, sHigh = 0, bLow = 0, bHigh = 0;
+	bool seen[6] = { false, false, false, false, false, false }; //R, C, M, S, B, N
+
+	while( std::getline( in, part, ',' ) )
+	{
+		if( part.empty() )
+			return false;
+		char kind = toupper( (unsigned char)part[0] );
+		std::string rest = part.substr( 1 );
+		int which = -1;
+		bool ok = false;
+
+		if( kind == 'R' )
+		{
+			which = 0;
+			ok = parseNumber( rest, newRadius );
+		}
+		else if( kind == 'C' )
+		{
+			which = 1;
+			ok = parseNumber( rest, states ) && ( states == 0 || states == 2 );
+		}
+		else if( kind == 'M' )
+		{
+			which = 2;
+			ok = parseNumber( rest, newMiddle ) && newMiddle <= 1;
+		}
+		else if( kind == 'S' )
+		{
+			which = 3;
+			ok = parseRange( rest, sLow, sHigh );
+		}
+		else if( kind == 'B' )
+		{
+			which = 4;
+			ok = parseRange( rest, bLow, bHigh );
+		}
+		else if( kind == 'N' )
+		{
+			which = 5;
+			ok = rest.size() == 1 && toupper( (unsigned char)rest[0] ) == 'M';
+		}
+		if( !ok || seen[which] )
+			return false;
+		seen[which] = true;
+	}
+	if( !seen[0] || !seen[3] || !seen[4] )
+		return false;
+
+	int most = (2 * newRadius + 1) * (2 * newRadius + 1);
+	if( newRadius < 1 || newRadius > LTL_MAX_RADIUS || sHigh > most || bHigh > most )
+		return false;
+
+	radius = newRadius;
+	middle = newMiddle == 1;
+	surviveMin = sLow;
+	surviveMax = sHigh;
+	birthMin = bLow;
+	birthMax = bHigh;
+	buildTable();
+	return true;
+}
+
+/********************************************************************************
+*	Function: getRule()
+*	Description: Returns the rule in Golly's form
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns the rule string
+* ******************************************************************************/
+std::string LtlEngine::getRule() const
+{
+	std::ostringstream out;
+
+	out << "R" << radius << ",C0,M" << ( middle ? 1 : 0 ) << ",S" << surviveMin << ".."
+		<< surviveMax << ",B" << birthMin << ".." << birthMax << ",NM";
+	return out.str();
+}
+
+/********************************************************************************
+*	Function: buildTable()
+*	Description: Fills the next state of a cell for every sum of its square and
+*		its state. The square's sum includes the cell itself, so without M1 a live
+*		cell has one neighbor fewer than its sum.
+*	Parameters: None
+*	Pre-Conditions: The rule is set
+*	Post-Conditions: table[sum * 2 + state] is the next state
+* ******************************************************************************/
+void LtlEngine::buildTable()
+{
+	int most = (2 * radius + 1) * (2 * radius + 1);
+
+	table.assign( 2 * (most + 1), 0 );
+	for( int sum = 0; sum <= most; sum++ )
+	{
+		int alive = middle ? sum : sum - 1;
+		table[sum * 2] = sum >= birthMin && sum <= birthMax;
+		table[sum * 2 + 1] = alive >= surviveMin && alive <= surviveMax;
+	}
+}
+
+/********************************************************************************
+*	Function: split( int )
+*	Description: Divides the rows into at most one band per thread. Bands are
+*		whole tiles, so no two threads mark the same tile.
+*	Parameters: The number of rows
+*	Pre-Conditions: None
+*	Post-Conditions: bandStart holds one row number per band, then rows
+* ******************************************************************************/
+void LtlEngine::split( int rows )
+{
+	long long tiles = (rows + TILE_ROWS - 1) / TILE_ROWS;
+	int bands = (int)std::min( (long long)threads, std::max( tiles, 1LL ) );
+
+	bandStart.assign( bands + 1, rows );
+	for( int t = 0; t < bands; t++ )
+		bandStart[t] = (int)std::min( (long long)rows, tiles * t / bands * TILE_ROWS );
+}
+
+/********************************************************************************
+*	Function: stepBand( Grid &, int )
+*	Description: Steps one band of the board a generation into next. The column
+*		sums start as the window around the band's first row and slide down one
+*		row at a time. The sums are padded with radius dead columns on each side,
+*		so the square of column c is prefix[c + 2R + 1] - prefix[c].
+*	Parameters: The board and the band
+*	Pre-Conditions: next has the board's size and split() covered its rows
+*	Post-Conditions: The band of next is the next generation and the band's
+*		changed tiles of the board are marked
+* ******************************************************************************/
+void LtlEngine::stepBand( Grid &grid, int t )
+{
+	int rows = grid.getRows();
+	int cols = grid.getCols();
+	int words = grid.getRowWords();
+	int width = 2 * radius + 1;
+	int first = bandStart[t];
+	int last = bandStart[t+1];
+	unsigned short *sums = &columnSums[t][0];
+	unsigned *prefix = &prefixSums[t][0];
+
+	std::fill( columnSums[t].begin(), columnSums[t].end(), 0 );
+	for( int i = std::max( 0, first - radius ); i <= std::min( rows - 1, first + radius ); i++ )
+		addRow( grid.row( i ), words, sums + radius, 1 );
+
+	for( int i = first; i < last; i++ )
+	{
+		if( i > first && i + radius < rows )
+			addRow( grid.row( i + radius ), words, sums + radius, 1 );
+		if( i > first && i - radius - 1 >= 0 )
+			addRow( grid.row( i - radius - 1 ), words, sums + radius, -1 );
+
+		//Unsigned sums wrap, but every difference of two is a true square
+		prefix[0] = 0;
+		for( int c = 0; c < cols + 2 * radius; c++ )
+			prefix[c+1] = prefix[c] + sums[c];
+
+		const uint64_t *now = grid.row( i );
+		uint64_t *out = next.row( i );
+		for( int w = 0; w < words; w++ )
+		{
+			int low = w * WORD_BITS;
+			int high = std::min( cols, low + WORD_BITS );
+			uint64_t bits = 0;
+
+			//A word whose squares are all empty is dead now and has one next state
+			if( prefix[high - 1 + width] == prefix[low] )
+				bits = table[0] ? ~0ULL : 0;
+			else
+			{
+				for( int c = low; c < high; c++ )
+				{
+					unsigned sum = prefix[c + width] - prefix[c];
+					uint64_t state = (now[w] >> (c - low)) & 1;
+					bits |= (uint64_t)table[sum * 2 + state] << (c - low);
+				}
+			}
+			if( w == words - 1 )
+				bits &= grid.getLastMask();
+
+			out[w] = bits;
+			if( bits != now[w] )
+				grid.markChanged( i, w );
+		}
+	}
+}
+
+/********************************************************************************
+*	Function: start()
+*	Description: Starts the helper threads if they are not running, one for
+*		each band after the first
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: threads - 1 helpers wait for a generation
+* ******************************************************************************/
+void LtlEngine::start()
+{
+	if( !helpers.empty() )
+		return;
+
+	long long current;
+	{
+		std::lock_guard<std::mutex> hold( lock );
+		current = round;
+	}
+	for( int t = 1; t < threads; t++ )
+		helpers.push_back( std::thread( &LtlEngine::help, this, t, current ) );
+}
+
+/********************************************************************************
+*	Function: help( int, long long )
+*	Description: The loop each helper runs: wait for a generation, step its
+*		band if the board has one for it, and report it is done
+*	Parameters: The helper's band and the last generation handed out before it
+*		was started
+*	Pre-Conditions: Started by start()
+*	Post-Conditions: Returns when the engine is stopping
+* ******************************************************************************/
+void LtlEngine::help( int t, long long seen )
+{
+	for( ;; )
+	{
+		bool stepping;
+		{
+			std::unique_lock<std::mutex> hold( lock );
+			while( round == seen && !stopping )
+				wake.wait( hold );
+			if( stopping )
+				return;
+			seen = round;
+
+			//Small boards have fewer bands than helpers
+			stepping = t < active;
+		}
+		if( !stepping )
+			continue;
+		stepBand( *target, t );
+
+		{
+			std::lock_guard<std::mutex> hold( lock );
+			if( --pending == 0 )
+				done.notify_one();
+		}
+	}
+}
+
+/********************************************************************************
+*	Function: advance( Grid &, int )
+*	Description: Advances every cell of a grid by a number of generations under
+*		the rule, the bands of each generation stepped in parallel. Cells
+*		beyond the edges are dead.
+*	Parameters: The grid to update and the number of generations
+*	Pre-Conditions: generations should not be negative
+*	Post-Conditions: The grid holds the board that many generations later and
+*		every tile that changed is marked
+* ******************************************************************************/
+void LtlEngine::advance( Grid &grid, int generations )
+{
+	int rows = grid.getRows();
+
+	if( rows == 0 || grid.getRowWords() == 0 )
+		return;
+	if( next.getRows() != rows || next.getCols() != grid.getCols() )
+		next.resize( rows, grid.getCols() );
+	split( rows );
+
+	int bands = (int)bandStart.size() - 1;
+	size_t padded = (size_t)grid.getRowWords() * WORD_BITS + 2 * radius;
+	columnSums.resize( bands );
+	prefixSums.resize( bands );
+	for( int t = 0; t < bands; t++ )
+	{
+		columnSums[t].resize( padded );
+		prefixSums[t].resize( padded + 1 );
+	}
+	if( bands > 1 )
+		start();
+	target = &grid;
+
+	for( int g = 0; g < generations; g++ )
+	{
+		//The calling thread steps the first band itself
+		if( bands > 1 )
+		{
+			{
+				std::lock_guard<std::mutex> hold( lock );
+				pending = bands - 1;
+				active = bands;
+				round++;
+			}
+			wake.notify_all();
+		}
+		stepBand( grid, 0 );
+		if( bands > 1 )
+		{
+			std::unique_lock<std::mutex> hold( lock );
+			while( pending > 0 )
+				done.wait( hold );
+		}
+
+		//Each band reads its rows and the radius around it once and writes once
+		trafficBytes += 2 * (long long)grid.bytes();
+		grid.swap( next );
+	}
+}
@@ -0,0 +1,148 @@
+/******************************************************************************
+ ** Program Filename: ltl.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the LtlEngine class. It steps a
+			Grid under a Larger-than-Life rule, where a cell's neighborhood is
+			the (2R+1) x (2R+1) square around it instead of the 8 cells that
+			Cells::countNeighbors reads. A dead cell is born when its count of
+			live neighbors is in the birth range and a live cell survives
+			when its count is in the survival range. Rules are written as in
+			Golly, "R5,C0,M1,S34..58,B34..45,NM" being Bosco's rule, where M1
+			counts the cell itself as one of its neighbors.
+			Each neighborhood is summed in constant time, so the cost per cell
+			barely grows with R: down each column a sliding sum keeps the live
+			cells of the 2R+1 rows around the current row, adding the row
+			entering the window and subtracting the one leaving it, and across
+			the row a prefix sum of those column sums gives every square as
+			one difference. The board is split into bands of whole tiles of
+			rows. The calling thread steps the first band and a pool of
+			helper threads, started on the first advance and kept until the
+			engine is destroyed, steps the others, so a generation costs a
+			wake-up rather than a thread start.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef LTL_HPP
+#define LTL_HPP
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "engine.hpp"
+
+#define LTL_MAX_RADIUS 500	//Largest neighborhood radius of a rule
+#define LTL_BOSCO "R5,C0,M1,S34..58,B34..45,NM"	//Bosco's rule, the default
+#define LTL_LIFE "R1,C0,M0,S2..3,B3..3,NM"		//Conway's Life
+
+//LtlEngine Class Declaration
+class LtlEngine : public Engine
+{
+	private:
+		int radius;			//Neighborhood radius R
+		bool middle;		//Whether a cell counts itself
+		int surviveMin;		//Survival range of neighbor counts
+		int surviveMax;
+		int birthMin;		//Birth range of neighbor counts
+		int birthMax;
+		int threads;		//Most bands stepped at once
+		std::vector<unsigned char> table; //Next state by window sum * 2 + state
+		std::vector<int> bandStart;		  //First row of each band, then rows
+		std::vector< std::vector<unsigned short> > columnSums; //Window of each band
+		std::vector< std::vector<unsigned> > prefixSums;	   //Row prefix of each band
+		Grid next;			//Board the next generation is written to
+		std::vector<std::thread> helpers;	//Threads stepping bands 1 and up
+		std::mutex lock;					//Guards round, pending, active and stopping
+		std::condition_variable wake;		//Signals a new generation to the helpers
+		std::condition_variable done;		//Signals the last helper finished one
+		long long round;	//Count of generations handed to the helpers
+		int pending;		//Helpers still stepping the current generation
+		int active;			//Bands in the current generation
+		bool stopping;		//Whether the helpers should leave
+		Grid *target;		//Board being stepped
+
+		LtlEngine( const LtlEngine & );
+		LtlEngine &operator=( const LtlEngine & );
+
+		void buildTable();
+		void split( int );
+		void stepBand( Grid &, int );
+		void start();
+		void help( int, long long );
+
+	public:
+		/********************************************************************************
+		*	Function: LtlEngine( int )
+		*	Description: Constructor of a Larger-than-Life engine running Bosco's rule
+		*	Parameters: The number of threads, 0 for one per core
+		*	Pre-Conditions: None
+		*	Post-Conditions: The engine is ready to advance grids
+		* ******************************************************************************/
+		LtlEngine( int = 0 );
+
+		/********************************************************************************
+		*	Function: ~LtlEngine()
+		*	Description: Destructor, stops and joins the helper threads
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: No helper is running
+		* ******************************************************************************/
+		~LtlEngine();
+
+		/********************************************************************************
+		*	Function: setRule( const std::string & )
+		*	Description: Parses and sets a rule in Golly's "Rr,Cc,Mm,Sa..b,Bc..d,Nn"
+		*		form, the parts in any order. C and N may be left out. A single count
+		*		such as "B3" is a range of one.
+		*	Parameters: The rule string
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false and leaves the rule unchanged if the string
+		*		is not a rule this engine runs: R must be 1-LTL_MAX_RADIUS, C 0 or 2
+		*		(two states), N M (the square), and the ranges within the square
+		* ******************************************************************************/
+		bool setRule( const std::string & );
+
+		/********************************************************************************
+		*	Function: getRule()
+		*	Description: Returns the rule in Golly's form
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the rule string
+		* ******************************************************************************/
+		std::string getRule() const;
+
+		/********************************************************************************
+		*	Function: sameRule( const LtlEngine & )
+		*	Description: Returns whether two engines give every cell the same next
+		*		state, however their rules were written: M1 with S3..4 is M0 with S2..3
+		*	Parameters: The other engine
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns true if the radius and every transition match
+		* ******************************************************************************/
+		bool sameRule( const LtlEngine &other ) const
+		{ return table == other.table; }
+
+		/********************************************************************************
+		*	Function: advance( Grid &, int )
+		*	Description: Advances every cell of a grid by a number of generations under
+		*		the rule, the bands of each generation stepped in parallel. Cells
+		*		beyond the edges are dead.
+		*	Parameters: The grid to update and the number of generations
+		*	Pre-Conditions: generations should not be negative
+		*	Post-Conditions: The grid holds the board that many generations later and
+		*		every tile that changed is marked
+		* ******************************************************************************/
+		void advance( Grid &, int );
+
+		const char *getName() const
+		{ return "ltl"; }
+
+		int getRadius() const
+		{ return radius; }
+
+		int getThreads() const
+		{ return threads; }
+};
+
+#endif
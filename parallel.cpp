@@ -0,0 +1,448 @@
+/******************************************************************************
+ ** Program Filename: parallel.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the ParallelEngine class function implementation file
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include "parallel.hpp"
+
+#define PARALLEL_TASK_NONE 0	//No round handed out yet
+#define PARALLEL_TASK_PLACE 1	//Copy the band into the untouched boards
+#define PARALLEL_TASK_STEP 2	//Step the band one generation
+#define PARALLEL_TASK_STOP 3	//Leave the worker loop
+
+/********************************************************************************
+*	Function: ParallelEngine( int, int, bool )
+*	Description: Constructor of a parallel engine. The workers are started on
+*		the first call to advance().
+*	Parameters: The number of workers, 0 for one per usable core, the affinity
+*		policy, and whether to place bands on their workers' nodes
+*	Pre-Conditions: None
+*	Post-Conditions: The engine is ready to advance grids
+* ******************************************************************************/
+ParallelEngine::ParallelEngine( int count, int affinity, bool place )
+{
+	threads = count > 0 ? count : topology.getCpuCount();
+	policy = affinity;
+	placement = place;
+	task = PARALLEL_TASK_NONE;
+	round = 0;
+	pending = 0;
+	target = NULL;
+	placedA = NULL;
+	placedB = NULL;
+}
+
+/********************************************************************************
+*	Function: ~ParallelEngine()
+*	Description: Destructor, stops and joins the workers
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: No worker is running
+* ******************************************************************************/
+ParallelEngine::~ParallelEngine()
+{
+	stop();
+}
+
+/********************************************************************************
+*	Function: start()
+*	Description: Starts the workers if they are not running, choosing each one's
+*		core from the affinity policy
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: threads workers wait for a round
+* ******************************************************************************/
+void ParallelEngine::start()
+{
+	if( !workers.empty() )
+		return;
+
+	std::vector<int> cores = topology.order( policy );
+	workerCpu.assign( threads, -1 );
+	workerNode.assign( threads, 0 );
+	workerSeconds.assign( threads, 0 );
+
+	for( int t = 0; t < threads; t++ )
+		if( policy != AFFINITY_NONE )
+		{
+			workerCpu[t] = cores[t % cores.size()];
+			workerNode[t] = topology.nodeOfCpu( workerCpu[t] );
+		}
+
+	//Workers started again after stop() must not take its round for a new one
+	long long current;
+	{
+		std::lock_guard<std::mutex> hold( lock );
+		current = round;
+	}
+	for( int t = 0; t < threads; t++ )
+		workers.push_back( std::thread( &ParallelEngine::work, this, t, current ) );
+}
+
+/********************************************************************************
+*	Function: stop()
+*	Description: Stops and joins the workers. The board will be placed again by
+*		the next advance.
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: No worker is running
+* ******************************************************************************/
+void ParallelEngine::stop()
+{
+	if( workers.empty() )
+		return;
+
+	{
+		std::lock_guard<std::mutex> hold( lock );
+		task = PARALLEL_TASK_STOP;
+		round++;
+	}
+	wake.notify_all();
+	for( size_t t = 0; t < workers.size(); t++ )
+		workers[t].join();
+
+	workers.clear();
+	placedA = NULL;
+	placedB = NULL;
+}
+
+/********************************************************************************
+*	Function: work( int, long long )
+*	Description: The loop each worker runs: pin itself, then wait for a round,
+*		run the task on its band, and report it is done
+*	Parameters: The worker's number and the last round handed out before it
+*		was started
+*	Pre-Conditions: Started by start()
+*	Post-Conditions: Returns when the task is PARALLEL_TASK_STOP
+* ******************************************************************************/
+void ParallelEngine::work( int t, long long seen )
+{
+
+	if( workerCpu[t] >= 0 && !Topology::pin( workerCpu[t] ) )
+		workerCpu[t] = -1;
+
+	for( ;; )
+	{
+		int job;
+		{
+			std::unique_lock<std::mutex> hold( lock );
+			while( round == seen )
+				wake.wait( hold );
+			seen = round;
+			job = task;
+		}
+		if( job == PARALLEL_TASK_STOP )
+			return;
+
+		//An unpinned worker may have moved, so look where it is now
+		if( workerCpu[t] < 0 )
+			workerNode[t] = topology.nodeOfCpu( Topology::currentCpu() );
+
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		if( job == PARALLEL_TASK_PLACE )
+			placeBand( t );
+		else
+			stepBand( t );
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+		if( job == PARALLEL_TASK_STEP )
+			workerSeconds[t] += std::chrono::duration<double>( end - begin ).count();
+
+		{
+			std::lock_guard<std::mutex> hold( lock );
+			if( --pending == 0 )
+				done.notify_one();
+		}
+	}
+}
+
+/********************************************************************************
+*	Function: run( int )
+*	Description: Hands a task to every worker and waits for all of them
+*	Parameters: The task
+*	Pre-Conditions: The workers are started
+*	Post-Conditions: Every worker has run the task on its band
+* ******************************************************************************/
+void ParallelEngine::run( int job )
+{
+	std::unique_lock<std::mutex> hold( lock );
+
+	task = job;
+	pending = threads;
+	round++;
+	wake.notify_all();
+	while( pending > 0 )
+		done.wait( hold );
+}
+
+/********************************************************************************
+*	Function: split( int )
+*	Description: Divides the rows into one band per worker. Bands are whole tiles
+*		of the change map, so no two workers mark the same tile.
+*	Parameters: The number of rows on the board
+*	Pre-Conditions: None
+*	Post-Conditions: bandStart holds threads + 1 row numbers
+* ******************************************************************************/
+void ParallelEngine::split( int rows )
+{
+	long long tiles = (rows + TILE_ROWS - 1) / TILE_ROWS;
+
+	bandStart.assign( threads + 1, rows );
+	for( int t = 0; t < threads; t++ )
+		bandStart[t] = (int)std::min( (long long)rows, tiles * t / threads * TILE_ROWS );
+}
+
+/********************************************************************************
+*	Function: placeBand( int )
+*	Description: Copies a worker's band of the board into the untouched front
+*		board and clears its band of the back board, so this worker is the
+*		first to touch those pages
+*	Parameters: The worker's number
+*	Pre-Conditions: front and back are the size of the board
+*	Post-Conditions: The band of front matches the board
+* ******************************************************************************/
+void ParallelEngine::placeBand( int t )
+{
+	size_t size = target->getRowWords() * sizeof(uint64_t);
+
+	for( int i = bandStart[t]; i < bandStart[t+1]; i++ )
+	{
+		memcpy( front.row( i ), target->row( i ), size );
+		memset( back.row( i ), 0, size );
+	}
+}
+
+/********************************************************************************
+*	Function: stepBand( int )
+*	Description: Steps a worker's band of the board one generation into the
+*		back board and marks the tiles that changed
+*	Parameters: The worker's number
+*	Pre-Conditions: back is the size of the board
+*	Post-Conditions: The band of back is the next generation
+* ******************************************************************************/
+void ParallelEngine::stepBand( int t )
+{
+	Grid &grid = *target;
+	int rows = grid.getRows();
+	int words = grid.getRowWords();
+
+	for( int i = bandStart[t]; i < bandStart[t+1]; i++ )
+	{
+		const uint64_t *above = i > 0 ? grid.row( i-1 ) : &zeros[0];
+		const uint64_t *below = i + 1 < rows ? grid.row( i+1 ) : &zeros[0];
+		lifeRow( above, grid.row( i ), below, back.row( i ), words, grid.getLastMask() );
+
+		for( int w = 0; w < words; w++ )
+			if( back.row( i )[w] != grid.row( i )[w] )
+				grid.markChanged( i, w );
+	}
+}
+
+/********************************************************************************
+*	Function: place( Grid & )
+*	Description: Sets the engine up for a new board. With placement on, the board
+*		is moved into storage first touched band by band by the workers and its
+*		old storage freed. With placement off, the back board is cleared by the
+*		calling thread and the board is left where it is.
+*	Parameters: The board
+*	Pre-Conditions: The workers are started
+*	Post-Conditions: The board and the back board are placed and remembered
+* ******************************************************************************/
+void ParallelEngine::place( Grid &grid )
+{
+	int rows = grid.getRows();
+	int cols = grid.getCols();
+
+	target = &grid;
+	split( rows );
+	zeros.assign( grid.getRowWords(), 0 );
+
+	if( placement )
+	{
+		front.resizeUntouched( rows, cols );
+		back.resizeUntouched( rows, cols );
+		run( PARALLEL_TASK_PLACE );
+		grid.swap( front );
+		front.resize( 0, 0 );
+	}
+	else
+		back.resize( rows, cols );
+
+	placedA = grid.row( 0 );
+	placedB = back.row( 0 );
+}
+
+/********************************************************************************
+*	Function: advance( Grid &, int )
+*	Description: Advances every cell of a grid by a number of generations, each
+*		worker stepping its own band. With placement on, a board the engine has
+*		not placed is first moved into storage touched band by band by the
+*		workers.
+*	Parameters: The grid to update and the number of generations
+*	Pre-Conditions: generations should not be negative
+*	Post-Conditions: The grid holds the board that many generations later and
+*		every tile that changed is marked
+* ******************************************************************************/
+void ParallelEngine::advance( Grid &grid, int generations )
+{
+	if( grid.getRows() == 0 || grid.getRowWords() == 0 )
+		return;
+	start();
+
+	//The two boards are swapped every generation, so either may be the grid's
+	const uint64_t *g = grid.row( 0 );
+	const uint64_t *b = back.getRows() > 0 ? back.row( 0 ) : NULL;
+	bool placed = back.getRows() == grid.getRows() && back.getCols() == grid.getCols()
+			&& ( (g == placedA && b == placedB) || (g == placedB && b == placedA) );
+	if( !placed )
+		place( grid );
+	target = &grid;
+
+	for( int gen = 0; gen < generations; gen++ )
+	{
+		run( PARALLEL_TASK_STEP );
+
+		//The whole board is read once and written once per generation
+		trafficBytes += 2 * (long long)grid.bytes();
+		grid.swap( back );
+	}
+}
+
+/********************************************************************************
+*	Function: setPolicy( int, bool )
+*	Description: Changes the affinity policy and placement. Running workers are
+*		stopped and the board will be placed again on the next advance.
+*	Parameters: The affinity policy and whether to place bands
+*	Pre-Conditions: None
+*	Post-Conditions: The new policy is used from the next advance
+* ******************************************************************************/
+void ParallelEngine::setPolicy( int affinity, bool place )
+{
+	stop();
+	policy = affinity;
+	placement = place;
+}
+
+/********************************************************************************
+*	Function: resetStats()
+*	Description: Zeroes the busy time of every worker
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: Every node has 0 seconds busy
+* ******************************************************************************/
+void ParallelEngine::resetStats()
+{
+	workerSeconds.assign( workerSeconds.size(), 0 );
+}
+
+/********************************************************************************
+*	Function: getNodeWorkers( int )
+*	Description: Counts the workers running on a node
+*	Parameters: The index of the node in the topology
+*	Pre-Conditions: advance() has been called
+*	Post-Conditions: returns the count
+* ******************************************************************************/
+int ParallelEngine::getNodeWorkers( int n ) const
+{
+	int count = 0;
+
+	for( size_t t = 0; t < workerNode.size(); t++ )
+		if( workerNode[t] == n )
+			count++;
+	return count;
+}
+
+/********************************************************************************
+*	Function: getNodeRows( int )
+*	Description: Counts the rows in the bands of a node's workers
+*	Parameters: The index of the node in the topology
+*	Pre-Conditions: advance() has been called
+*	Post-Conditions: returns the count
+* ******************************************************************************/
+long long ParallelEngine::getNodeRows( int n ) const
+{
+	long long count = 0;
+
+	for( size_t t = 0; t < workerNode.size() && t + 1 < bandStart.size(); t++ )
+		if( workerNode[t] == n )
+			count += bandStart[t+1] - bandStart[t];
+	return count;
+}
+
+/********************************************************************************
+*	Function: getNodeSeconds( int )
+*	Description: Adds up the time a node's workers spent stepping
+*	Parameters: The index of the node in the topology
+*	Pre-Conditions: advance() has been called
+*	Post-Conditions: returns the seconds since the last resetStats()
+* ******************************************************************************/
+double ParallelEngine::getNodeSeconds( int n ) const
+{
+	double seconds = 0;
+
+	for( size_t t = 0; t < workerNode.size(); t++ )
+		if( workerNode[t] == n )
+			seconds += workerSeconds[t];
+	return seconds;
+}
+
+/********************************************************************************
+*	Function: countNodePages( const Grid &, int, long long &, long long & )
+*	Description: Asks the kernel where the pages of the bands of a node's
+*		workers are, on both the board and the back board. A page is local when
+*		it is on that node.
+*	Parameters: The board last advanced, the index of the node, and the counts
+*		of the band's pages and of those that are local to fill in
+*	Pre-Conditions: advance() was last called with this board
+*	Post-Conditions: returns false if the kernel cannot tell where pages are
+* ******************************************************************************/
+bool ParallelEngine::countNodePages( const Grid &grid, int n, long long &pages,
+		long long &local ) const
+{
+	const Grid *boards[] = { &grid, &back };
+	std::vector<int> nodes;
+
+	pages = 0;
+	local = 0;
+	for( size_t t = 0; t < workerNode.size() && t + 1 < bandStart.size(); t++ )
+	{
+		if( workerNode[t] != n || bandStart[t] == bandStart[t+1] )
+			continue;
+
+		for( int b = 0; b < 2; b++ )
+		{
+			if( boards[b]->getRows() != grid.getRows() )
+				continue;
+			size_t size = (size_t)(bandStart[t+1] - bandStart[t]) * grid.getRowWords()
+					* sizeof(uint64_t);
+			if( !topology.nodeOfPages( boards[b]->row( bandStart[t] ), size, nodes ) )
+				return false;
+
+			pages += (long long)nodes.size();
+			local += (long long)std::count( nodes.begin(), nodes.end(), n );
+		}
+	}
+	return true;
+}
+
+/********************************************************************************
+*	Function: getPinned()
+*	Description: Counts the workers pinned to a core
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns 0 before the first advance or with AFFINITY_NONE
+* ******************************************************************************/
+int ParallelEngine::getPinned() const
+{
+	int count = 0;
+
+	for( size_t t = 0; t < workerCpu.size(); t++ )
+		if( workerCpu[t] >= 0 )
+			count++;
+	return count;
+}
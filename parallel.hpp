@@ -0,0 +1,169 @@
+/******************************************************************************
+ ** Program Filename: parallel.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the ParallelEngine class. It
+			steps a Grid with a pool of worker threads, each owning a band of
+			whole tiles of rows. Workers are pinned to cores by an affinity
+			policy and stay alive between calls, so a band is always stepped
+			by the same core. With placement on, the engine moves the board
+			into storage that no thread has written yet and lets each worker
+			copy in its own band, so the kernel's first-touch rule puts every
+			band's pages on the NUMA node of the worker that steps it. The
+			grid's storage is swapped, not copied, so the placed pages stay
+			with the caller's Grid between calls. Per-node statistics report
+			the workers, rows, local pages and busy time of each node. On a
+			single node machine everything still works, there is just
+			nothing remote to avoid.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "engine.hpp"
+#include "topology.hpp"
+
+//ParallelEngine Class Declaration
+class ParallelEngine : public Engine
+{
+	private:
+		Topology topology;	//Nodes and cores of the machine
+		int threads;		//Number of workers
+		int policy;			//AFFINITY_NONE, AFFINITY_COMPACT or AFFINITY_SCATTER
+		bool placement;		//Whether bands are first touched by their workers
+		std::vector<std::thread> workers;	//The pool, started on the first advance
+		std::vector<int> workerCpu;			//Core each worker is pinned to, -1 if not
+		std::vector<int> workerNode;		//Node each worker runs on
+		std::vector<double> workerSeconds;	//Time each worker spent stepping
+		std::vector<int> bandStart;			//First row of each worker's band, then rows
+		std::mutex lock;					//Guards task, round and pending
+		std::condition_variable wake;		//Signals a new round to the workers
+		std::condition_variable done;		//Signals the last worker finished a round
+		int task;			//What the workers do in the current round
+		long long round;	//Count of rounds handed out
+		int pending;		//Workers still running the current round
+		Grid *target;		//Board being stepped or placed
+		Grid front;			//Untouched board a placed board is copied into
+		Grid back;			//Board the next generation is written to
+		const uint64_t *placedA; //Storage placed for the caller's board
+		const uint64_t *placedB; //Storage placed for the back board
+		std::vector<uint64_t> zeros;	//Dead row used above and below the board
+
+		ParallelEngine( const ParallelEngine & );
+		ParallelEngine &operator=( const ParallelEngine & );
+
+		void start();
+		void stop();
+		void work( int, long long );
+		void run( int );
+		void split( int );
+		void place( Grid & );
+		void stepBand( int );
+		void placeBand( int );
+
+	public:
+		/********************************************************************************
+		*	Function: ParallelEngine( int, int, bool )
+		*	Description: Constructor of a parallel engine. The workers are started on
+		*		the first call to advance().
+		*	Parameters: The number of workers, 0 for one per usable core, the affinity
+		*		policy, and whether to place bands on their workers' nodes
+		*	Pre-Conditions: None
+		*	Post-Conditions: The engine is ready to advance grids
+		* ******************************************************************************/
+		ParallelEngine( int = 0, int = AFFINITY_COMPACT, bool = true );
+
+		/********************************************************************************
+		*	Function: ~ParallelEngine()
+		*	Description: Destructor, stops and joins the workers
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: No worker is running
+		* ******************************************************************************/
+		~ParallelEngine();
+
+		/********************************************************************************
+		*	Function: advance( Grid &, int )
+		*	Description: Advances every cell of a grid by a number of generations, each
+		*		worker stepping its own band. With placement on, a board the engine has
+		*		not placed is first moved into storage touched band by band by the
+		*		workers.
+		*	Parameters: The grid to update and the number of generations
+		*	Pre-Conditions: generations should not be negative
+		*	Post-Conditions: The grid holds the board that many generations later and
+		*		every tile that changed is marked
+		* ******************************************************************************/
+		void advance( Grid &, int );
+
+		/********************************************************************************
+		*	Function: setPolicy( int, bool )
+		*	Description: Changes the affinity policy and placement. Running workers are
+		*		stopped and the board will be placed again on the next advance.
+		*	Parameters: The affinity policy and whether to place bands
+		*	Pre-Conditions: None
+		*	Post-Conditions: The new policy is used from the next advance
+		* ******************************************************************************/
+		void setPolicy( int, bool );
+
+		/********************************************************************************
+		*	Function: resetStats()
+		*	Description: Zeroes the busy time of every worker
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: Every node has 0 seconds busy
+		* ******************************************************************************/
+		void resetStats();
+
+		/********************************************************************************
+		*	Function: getNodeWorkers( int ), getNodeRows( int ), getNodeSeconds( int )
+		*	Description: Per-node statistics: the workers running on a node, the rows
+		*		of their bands, and the time they spent stepping
+		*	Parameters: The index of the node in the topology
+		*	Pre-Conditions: advance() has been called
+		*	Post-Conditions: returns the statistic, 0 for a node with no workers
+		* ******************************************************************************/
+		int getNodeWorkers( int ) const;
+		long long getNodeRows( int ) const;
+		double getNodeSeconds( int ) const;
+
+		/********************************************************************************
+		*	Function: countNodePages( const Grid &, int, long long &, long long & )
+		*	Description: Asks the kernel where the pages of the bands of a node's
+		*		workers are. A page is local when it is on that node.
+		*	Parameters: The board last advanced, the index of the node, and the counts
+		*		of the band's pages and of those that are local to fill in
+		*	Pre-Conditions: advance() was last called with this board
+		*	Post-Conditions: returns false if the kernel cannot tell where pages are
+		* ******************************************************************************/
+		bool countNodePages( const Grid &, int, long long &, long long & ) const;
+
+		/********************************************************************************
+		*	Function: getPinned()
+		*	Description: Counts the workers pinned to a core
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns 0 before the first advance or with AFFINITY_NONE
+		* ******************************************************************************/
+		int getPinned() const;
+
+		const Topology &getTopology() const
+		{ return topology; }
+
+		int getThreads() const
+		{ return threads; }
+
+		int getPolicy() const
+		{ return policy; }
+
+		bool getPlacement() const
+		{ return placement; }
+
+		const char *getName() const
+		{ return "parallel"; }
+};
+
+#endif
@@ -0,0 +1,28 @@
+/******************************************************************************
+ ** Program Filename: patterns.h
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: The patterns the ex1 menu places, as RLE for
+			Simulation::loadPattern or golLoadPattern, each with the offset of
+			its top left from the cell it is placed at. Placed at a cell, each
+			is the same as the Cells function that drew it in the World array:
+			the small oscillator, glider and glider gun. Plain macros, so C
+			clients of gol.h can use them too.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef PATTERNS_H
+#define PATTERNS_H
+
+#define LFSO_RLE "o$o$o!"	//Cells::createLFSO, the blinker
+#define LFSO_ROW -1
+#define LFSO_COL 0
+#define GLIDER_RLE "o$b2o$2o!"	//Cells::createGlider
+#define GLIDER_ROW -1
+#define GLIDER_COL -1
+#define GUN_RLE "12b2o$11bo3bo$2o8bo5bo7bo$2o8bo3bob2o4bobo$10bo5bo3b2o$" \
+		"11bo3bo4b2o12b2o$12b2o6b2o12b2o$22bobo$24bo!"	//Cells::createGliderGun
+#define GUN_ROW -3
+#define GUN_COL -17
+
+#endif
@@ -0,0 +1,247 @@
+/******************************************************************************
+ ** Program Filename: perfcount.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the PerfCounters class function implementation file
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#include <cerrno>
+#include <cstring>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "perfcount.hpp"
+
+#define PERF_ALONE -1	//Open an event outside any group
+#define PERF_LEADER -2	//Open an event as the leader of a new group
+
+/********************************************************************************
+*	Function: openEvent( uint32_t, uint64_t, int )
+*	Description: Opens one counter for the calling thread, user space only. A
+*		counter opened alone, or as the leader of a group, starts stopped and
+*		reads with its enabled and running times. A member of a group counts
+*		whenever its leader does, and the leader reads every member at once.
+*	Parameters: The perf event type and config, and the file of the group's
+*		leader, or PERF_ALONE, or PERF_LEADER to open a new group's leader
+*	Pre-Conditions: None
+*	Post-Conditions: returns the file, or -1 with errno set
+* ******************************************************************************/
+static int openEvent( uint32_t type, uint64_t config, int group )
+{
+	struct perf_event_attr attr;
+
+	memset( &attr, 0, sizeof(attr) );
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = group < 0;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	if( group != PERF_ALONE )
+		attr.read_format |= PERF_FORMAT_GROUP;
+
+	return (int)syscall( SYS_perf_event_open, &attr, 0, -1, group < 0 ? -1 : group, 0 );
+}
+
+/********************************************************************************
+*	Function: scale( uint64_t, uint64_t, uint64_t )
+*	Description: Scales a count up from the time its event was on a counter to
+*		the time it was enabled
+*	Parameters: The count, and the times enabled and running
+*	Pre-Conditions: None
+*	Post-Conditions: returns the scaled count
+* ******************************************************************************/
+static long long scale( uint64_t count, uint64_t enabled, uint64_t running )
+{
+	if( running > 0 && running < enabled )
+		count = (uint64_t)((double)count * enabled / running);
+	return (long long)count;
+}
+
+/********************************************************************************
+*	Function: PerfCounters()
+*	Description: Constructor, opens every event that is available
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: The counters are open and stopped
+* ******************************************************************************/
+PerfCounters::PerfCounters()
+{
+	uint32_t types[PERF_EVENTS] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+			PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+			PERF_TYPE_SOFTWARE };
+	uint64_t configs[PERF_EVENTS] = { PERF_COUNT_HW_CPU_CYCLES,
+			PERF_COUNT_HW_INSTRUCTIONS,
+			PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+					| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+			PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES,
+			PERF_COUNT_SW_TASK_CLOCK };
+
+	fds.assign( PERF_EVENTS, -1 );
+	values.assign( PERF_EVENTS, 0 );
+	totals.assign( PERF_EVENTS, 0 );
+	seconds = 0;
+	totalSeconds = 0;
+	samples = 0;
+
+	//Cycles and instructions are grouped so IPC compares the same windows
+	grouped = false;
+	fds[PERF_CYCLES] = openEvent( types[PERF_CYCLES], configs[PERF_CYCLES], PERF_LEADER );
+	if( fds[PERF_CYCLES] >= 0 )
+	{
+		fds[PERF_INSTRUCTIONS] = openEvent( types[PERF_INSTRUCTIONS],
+				configs[PERF_INSTRUCTIONS], fds[PERF_CYCLES] );
+		grouped = fds[PERF_INSTRUCTIONS] >= 0;
+		if( !grouped )
+		{
+			close( fds[PERF_CYCLES] );
+			fds[PERF_CYCLES] = -1;
+		}
+	}
+
+	for( int e = 0; e < PERF_EVENTS; e++ )
+	{
+		if( grouped && (e == PERF_CYCLES || e == PERF_INSTRUCTIONS) )
+			continue;
+		fds[e] = openEvent( types[e], configs[e], PERF_ALONE );
+		if( fds[e] < 0 && error.empty() )
+			error = std::string( eventName( e ) ) + ": " + strerror( errno );
+	}
+}
+
+/********************************************************************************
+*	Function: ~PerfCounters()
+*	Description: Destructor, closes the counters
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: Every event is closed
+* ******************************************************************************/
+PerfCounters::~PerfCounters()
+{
+	for( int e = 0; e < PERF_EVENTS; e++ )
+		if( fds[e] >= 0 )
+			close( fds[e] );
+}
+
+/********************************************************************************
+*	Function: control( unsigned long )
+*	Description: Sends a request to every open counter. A group is sent it
+*		through its leader, which passes it to the members.
+*	Parameters: The ioctl request
+*	Pre-Conditions: None
+*	Post-Conditions: The request is sent
+* ******************************************************************************/
+void PerfCounters::control( unsigned long request )
+{
+	for( int e = 0; e < PERF_EVENTS; e++ )
+	{
+		if( fds[e] < 0 || (grouped && e == PERF_INSTRUCTIONS) )
+			continue;
+		ioctl( fds[e], request, grouped && e == PERF_CYCLES ? PERF_IOC_FLAG_GROUP : 0 );
+	}
+}
+
+/********************************************************************************
+*	Function: start()
+*	Description: Zeroes and starts the clock and every counter
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: A sample is being taken
+* ******************************************************************************/
+void PerfCounters::start()
+{
+	control( PERF_EVENT_IOC_RESET );
+	begin = std::chrono::steady_clock::now();
+	control( PERF_EVENT_IOC_ENABLE );
+}
+
+/********************************************************************************
+*	Function: stop()
+*	Description: Stops the counters, then the clock, and reads the sample, so
+*		the clock covers all the time counted. Counts from events the kernel
+*		had to share a counter between are scaled up to the whole sample.
+*	Parameters: None
+*	Pre-Conditions: start() was called
+*	Post-Conditions: The sample is read and added to the totals
+* ******************************************************************************/
+void PerfCounters::stop()
+{
+	control( PERF_EVENT_IOC_DISABLE );
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	seconds = std::chrono::duration<double>( end - begin ).count();
+	totalSeconds += seconds;
+	samples++;
+
+	for( int e = 0; e < PERF_EVENTS; e++ )
+		values[e] = 0;
+
+	//A group reads as its size, its times, then the count of each member
+	if( grouped )
+	{
+		uint64_t data[5] = { 0, 0, 0, 0, 0 };
+		if( read( fds[PERF_CYCLES], data, sizeof(data) ) == (ssize_t)sizeof(data) )
+		{
+			values[PERF_CYCLES] = scale( data[3], data[1], data[2] );
+			values[PERF_INSTRUCTIONS] = scale( data[4], data[1], data[2] );
+		}
+	}
+
+	for( int e = 0; e < PERF_EVENTS; e++ )
+	{
+		uint64_t data[3] = { 0, 0, 0 };	//value, time enabled, time running
+
+		if( fds[e] >= 0 && !(grouped && (e == PERF_CYCLES || e == PERF_INSTRUCTIONS))
+				&& read( fds[e], data, sizeof(data) ) == (ssize_t)sizeof(data) )
+			values[e] = scale( data[0], data[1], data[2] );
+		totals[e] += values[e];
+	}
+}
+
+/********************************************************************************
+*	Function: reset()
+*	Description: Zeroes the totals
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: No samples are counted
+* ******************************************************************************/
+void PerfCounters::reset()
+{
+	totals.assign( PERF_EVENTS, 0 );
+	totalSeconds = 0;
+	samples = 0;
+}
+
+/********************************************************************************
+*	Function: hardware()
+*	Description: Returns whether any hardware event could be opened
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns false when only timing is possible
+* ******************************************************************************/
+bool PerfCounters::hardware() const
+{
+	for( int e = 0; e < PERF_EVENTS; e++ )
+		if( e != PERF_TASK_CLOCK && fds[e] >= 0 )
+			return true;
+	return false;
+}
+
+/********************************************************************************
+*	Function: eventName( int )
+*	Description: Returns a short name of an event for reports
+*	Parameters: The event
+*	Pre-Conditions: None
+*	Post-Conditions: returns the name
+* ******************************************************************************/
+const char *PerfCounters::eventName( int event )
+{
+	const char *names[PERF_EVENTS] = { "cycles", "instructions", "L1d-misses",
+			"LLC-misses", "branch-misses", "task-clock" };
+
+	return event >= 0 && event < PERF_EVENTS ? names[event] : "unknown";
+}
@@ -0,0 +1,159 @@
+/******************************************************************************
+ ** Program Filename: perfcount.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the PerfCounters class. It
+			reads the processor's hardware performance counters through
+			perf_event_open: cycles, instructions, L1 data cache read misses,
+			last level cache misses and branch mispredictions, with the task
+			clock as well. Counting covers user space only, so it works at
+			the default perf_event_paranoid setting, and only the thread that
+			opened the counters, so engines that hand work to other threads
+			are not measured by it. Cycles and instructions are opened as one
+			group, so when the kernel has to share the counters it schedules
+			them together and IPC compares counts from the same time. Every
+			other event, and those two if the group cannot be opened, is
+			opened on its own, so any that the machine or a virtual machine
+			does not offer are simply unavailable, and with none available the
+			counters still time each sample with the wall clock. Samples
+			between start() and stop() are also added to running totals.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef PERFCOUNT_HPP
+#define PERFCOUNT_HPP
+#include <chrono>
+#include <string>
+#include <vector>
+
+#define PERF_CYCLES 0		//Core clock cycles
+#define PERF_INSTRUCTIONS 1	//Instructions retired
+#define PERF_L1D_MISSES 2	//L1 data cache read misses
+#define PERF_LLC_MISSES 3	//Last level cache misses
+#define PERF_BRANCH_MISSES 4 //Mispredicted branches
+#define PERF_TASK_CLOCK 5	//CPU time in nanoseconds, a software counter
+#define PERF_EVENTS 6		//Number of events
+
+//PerfCounters Class Declaration
+class PerfCounters
+{
+	private:
+		std::vector<int> fds;			//File of each event, -1 if unavailable
+		bool grouped;					//Whether cycles leads a group with instructions
+		std::vector<long long> values;	//Counts of the last sample
+		std::vector<long long> totals;	//Counts of every sample since reset()
+		double seconds;		//Wall time of the last sample
+		double totalSeconds;	//Wall time of every sample since reset()
+		long long samples;	//Samples since reset()
+		std::string error;	//Why the first unavailable event could not be opened
+		std::chrono::steady_clock::time_point begin; //When the sample started
+
+		PerfCounters( const PerfCounters & );
+		PerfCounters &operator=( const PerfCounters & );
+
+		void control( unsigned long );
+
+	public:
+		/********************************************************************************
+		*	Function: PerfCounters()
+		*	Description: Constructor, opens every event that is available
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: The counters are open and stopped
+		* ******************************************************************************/
+		PerfCounters();
+
+		/********************************************************************************
+		*	Function: ~PerfCounters()
+		*	Description: Destructor, closes the counters
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: Every event is closed
+		* ******************************************************************************/
+		~PerfCounters();
+
+		/********************************************************************************
+		*	Function: start()
+		*	Description: Zeroes and starts the clock and every counter
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: A sample is being taken
+		* ******************************************************************************/
+		void start();
+
+		/********************************************************************************
+		*	Function: stop()
+		*	Description: Stops the counters, then the clock, and reads the sample, so
+		*		the clock covers all the time counted. Counts from events the kernel
+		*		had to share a counter between are scaled up to the whole sample.
+		*	Parameters: None
+		*	Pre-Conditions: start() was called
+		*	Post-Conditions: The sample is read and added to the totals
+		* ******************************************************************************/
+		void stop();
+
+		/********************************************************************************
+		*	Function: reset()
+		*	Description: Zeroes the totals
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: No samples are counted
+		* ******************************************************************************/
+		void reset();
+
+		/********************************************************************************
+		*	Function: available( int )
+		*	Description: Returns whether an event could be opened
+		*	Parameters: The event
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns true if the event is counted
+		* ******************************************************************************/
+		bool available( int event ) const
+		{ return event >= 0 && event < PERF_EVENTS && fds[event] >= 0; }
+
+		/********************************************************************************
+		*	Function: hardware()
+		*	Description: Returns whether any hardware event could be opened
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false when only timing is possible
+		* ******************************************************************************/
+		bool hardware() const;
+
+		/********************************************************************************
+		*	Function: getValue( int ), getTotal( int )
+		*	Description: Returns the count of an event in the last sample, or in every
+		*		sample since reset()
+		*	Parameters: The event
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the count, -1 if the event is unavailable
+		* ******************************************************************************/
+		long long getValue( int event ) const
+		{ return available( event ) ? values[event] : -1; }
+
+		long long getTotal( int event ) const
+		{ return available( event ) ? totals[event] : -1; }
+
+		double getSeconds() const
+		{ return seconds; }
+
+		double getTotalSeconds() const
+		{ return totalSeconds; }
+
+		long long getSamples() const
+		{ return samples; }
+
+		const std::string &getError() const
+		{ return error; }
+
+		/********************************************************************************
+		*	Function: eventName( int )
+		*	Description: Returns a short name of an event for reports
+		*	Parameters: The event
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the name
+		* ******************************************************************************/
+		static const char *eventName( int );
+};
+
+#endif
@@ -0,0 +1,678 @@
+/******************************************************************************
+ ** Program Filename: simulation.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the Simulation class function implementation file
+ ** Input: Patterns as RLE or plaintext
+ ** Output: Frame files
+ * ***************************************************************************/
+#include <cctype>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+#include "simulation.hpp"
+#include "grid.hpp"
+#include "engine.hpp"
+#include "viewport.hpp"
+#include "writer.hpp"
+#include "sweep.hpp"
+#include "temporal.hpp"
+#include "parallel.hpp"
+#include "ltl.hpp"
+#include "soup.hpp"
+
+#define SIM_MAX_RUN 1000000000LL	//Longest run count read from an RLE pattern
+
+static_assert( SIM_FRAME_RLE == FRAME_RLE && SIM_FRAME_BINARY == FRAME_BINARY
+		&& SIM_FRAME_PGM == FRAME_PGM, "simulation.hpp frame formats must match writer.hpp" );
+
+//Simulation::Impl Declaration, the state behind a Simulation
+struct Simulation::Impl
+{
+	Grid board;			//The cells
+	Engine *engine;		//Engine stepping the board, owned
+	std::string engineName; //Name the engine was chosen by
+	std::string rule;	//SIM_LIFE or a Larger-than-Life rule
+	int threads;		//Threads of the parallel engines, 0 for one per core
+	long long generation; //Generations stepped since the board was last cleared
+	double stepSeconds;	//Time spent stepping since the board was last cleared
+	Viewport viewport;	//Window drawn by render()
+	FrameWriter *frames; //Writer of a frame after every step, owned, NULL if none
+	std::vector<int> patternRows;	//Live cells of the pattern being loaded
+	std::vector<int> patternCols;
+
+	Impl( int, int, int );
+	~Impl();
+
+	Engine *makeEngine( const std::string &, const std::string & ) const;
+	bool addCell( long long, long long );
+	bool parseRle( const std::string &, int, int, std::string & );
+	bool parsePlain( const std::string &, int, int );
+
+	private:
+		Impl( const Impl & );
+		Impl &operator=( const Impl & );
+};
+
+/********************************************************************************
+*	Function: isLife( const std::string & )
+*	Description: Returns whether a rule string is Conway's Life
+*	Parameters: The rule string
+*	Pre-Conditions: None
+*	Post-Conditions: returns true for "B3/S23", "S23/B3" and "23/3", in any case,
+*		and for any Larger-than-Life rule that steps cells as Life does, such as
+*		LTL_LIFE
+* ******************************************************************************/
+static bool isLife( const std::string &rule )
+{
+	std::string upper;
+
+	for( size_t i = 0; i < rule.size(); i++ )
+		upper += toupper( (unsigned char)rule[i] );
+	if( upper == "B3/S23" || upper == "S23/B3" || upper == "23/3" )
+		return true;
+
+	//Compare the parsed tables, so every spelling of Life in Golly's form counts
+	LtlEngine parsed( 1 ), life( 1 );
+	return parsed.setRule( rule ) && life.setRule( LTL_LIFE ) && parsed.sameRule( life );
+}
+
+/********************************************************************************
+*	Function: Simulation( int, int, int )
+*	Description: Constructor of an empty board stepped by the sweep under Life
+*	Parameters: The rows and columns of the board, and the threads the parallel
+*		engines use, 0 for one per core
+*	Pre-Conditions: rows and columns should not be negative
+*	Post-Conditions: Every cell is dead and the generation is 0
+* ******************************************************************************/
+Simulation::Simulation( int rows, int cols, int count )
+{
+	impl = new Impl( rows, cols, count );
+}
+
+Simulation::Impl::Impl( int rows, int cols, int count ) : board( rows, cols )
+{
+	threads = count;
+	rule = SIM_LIFE;
+	engineName = SIM_ENGINE;
+	engine = makeEngine( engineName, rule );
+	generation = 0;
+	stepSeconds = 0;
+	frames = NULL;
+	viewport.center( rows / 2, cols / 2 );
+}
+
+/********************************************************************************
+*	Function: ~Simulation()
+*	Description: Destructor, frees the engine and finishes writing frames
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: The engine is freed and every frame is on disk
+* ******************************************************************************/
+Simulation::~Simulation()
+{
+	delete impl;
+}
+
+Simulation::Impl::~Impl()
+{
+	delete frames;
+	delete engine;
+}
+
+/********************************************************************************
+*	Function: makeEngine( const std::string &, const std::string & )
+*	Description: Creates an engine by name set up to run a rule
+*	Parameters: The engine's name and the rule
+*	Pre-Conditions: None
+*	Post-Conditions: returns the engine, which the caller frees, or NULL if the
+*		name is unknown or the engine cannot run the rule
+* ******************************************************************************/
+Engine *Simulation::Impl::makeEngine( const std::string &name, const std::string &newRule ) const
+{
+	if( name == "ltl" )
+	{
+		LtlEngine *ltl = new LtlEngine( threads );
+		if( !ltl->setRule( isLife( newRule ) ? LTL_LIFE : newRule ) )
+		{
+			delete ltl;
+			return NULL;
+		}
+		return ltl;
+	}
+
+	if( !isLife( newRule ) )
+		return NULL;
+	if( name == "sweep" )
+		return new SweepEngine();
+	if( name == "temporal" )
+		return new TemporalEngine();
+	if( name == "parallel" )
+		return new ParallelEngine( threads );
+	return NULL;
+}
+
+/********************************************************************************
+*	Function: setEngine( const std::string & )
+*	Description: Chooses the engine that steps the board: "sweep", "temporal",
+*		"parallel" or "ltl". Life is run by every engine, other rules only by
+*		"ltl".
+*	Parameters: The engine's name
+*	Pre-Conditions: None
+*	Post-Conditions: returns false and keeps the engine if the name is unknown
+*		or the engine cannot run the rule
+* ******************************************************************************/
+bool Simulation::setEngine( const std::string &name )
+{
+	Engine *chosen = impl->makeEngine( name, impl->rule );
+
+	if( !chosen )
+		return false;
+	delete impl->engine;
+	impl->engine = chosen;
+	impl->engineName = name;
+	return true;
+}
+
+/********************************************************************************
+*	Function: setRule( const std::string & )
+*	Description: Sets the rule. "B3/S23", "S23/B3", "23/3" and Larger-than-Life
+*		rules that step as Life does, such as LTL_LIFE, are Life, kept with the
+*		current engine unless that is "ltl", which is replaced by the sweep.
+*		Any other Larger-than-Life rule in Golly's form, such as
+*		"R5,C0,M1,S34..58,B34..45,NM", switches to the "ltl" engine.
+*	Parameters: The rule string
+*	Pre-Conditions: None
+*	Post-Conditions: returns false and leaves the rule unchanged if the string
+*		is not a rule the engines run
+* ******************************************************************************/
+bool Simulation::setRule( const std::string &newRule )
+{
+	std::string name = "ltl";
+
+	if( isLife( newRule ) )
+	{
+		//Every engine but "ltl" already runs Life
+		if( impl->engineName != "ltl" )
+		{
+			impl->rule = SIM_LIFE;
+			if( impl->frames )
+				impl->frames->setRule( impl->rule );
+			return true;
+		}
+		name = SIM_ENGINE;
+	}
+
+	Engine *chosen = impl->makeEngine( name, newRule );
+	if( !chosen )
+		return false;
+	delete impl->engine;
+	impl->engine = chosen;
+	impl->engineName = name;
+
+	LtlEngine *ltl = dynamic_cast<LtlEngine *>( chosen );
+	impl->rule = ltl ? ltl->getRule() : SIM_LIFE;
+	if( impl->frames )
+		impl->frames->setRule( impl->rule );
+	return true;
+}
+
+/********************************************************************************
+*	Function: addCell( long long, long long )
+*	Description: Adds a live cell to the pattern being loaded
+*	Parameters: The board row and column of the cell
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the cell is off the board
+* ******************************************************************************/
+bool Simulation::Impl::addCell( long long r, long long c )
+{
+	if( r < 0 || c < 0 || r >= board.getRows() || c >= board.getCols() )
+		return false;
+	patternRows.push_back( (int)r );
+	patternCols.push_back( (int)c );
+	return true;
+}
+
+/********************************************************************************
+*	Function: parseRle( const std::string &, int, int, std::string & )
+*	Description: Reads the live cells of an RLE pattern. Lines starting with '#'
+*		are comments, a line starting with 'x' is the header, and the body is
+*		runs of 'b' (dead), any other letter (alive) and '$' (end of row), each
+*		with an optional count, up to '!'.
+*	Parameters: The pattern, the board row and column of its top left, and the
+*		string to hold the header's rule
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the text is not RLE or a live cell is off
+*		the board. The cells are in patternRows and patternCols.
+* ******************************************************************************/
+bool Simulation::Impl::parseRle( const std::string &text, int row, int col, std::string &headerRule )
+{
+	std::istringstream in( text );
+	std::string line;
+	long long r = 0, c = 0, count = 0;
+	bool body = false;
+
+	while( std::getline( in, line ) )
+	{
+		size_t start = line.find_first_not_of( " \t\r" );
+		if( start == std::string::npos || line[start] == '#' )
+			continue;
+
+		if( !body && line[start] == 'x' )
+		{
+			size_t found = line.find( "rule" );
+			if( found != std::string::npos )
+				found = line.find( '=', found );
+			if( found != std::string::npos )
+			{
+				size_t first = line.find_first_not_of( " \t", found + 1 );
+				size_t last = line.find_last_not_of( " \t\r" );
+				if( first != std::string::npos && last >= first )
+					headerRule = line.substr( first, last - first + 1 );
+			}
+			continue;
+		}
+		body = true;
+
+		for( size_t i = start; i < line.size(); i++ )
+		{
+			char ch = line[i];
+			long long run = count > 0 ? count : 1;
+
+			if( isdigit( (unsigned char)ch ) )
+			{
+				count = count * 10 + (ch - '0');
+				if( count > SIM_MAX_RUN )
+					return false;
+				continue;
+			}
+			if( isspace( (unsigned char)ch ) )
+				continue;
+			count = 0;
+
+			if( ch == '!' )
+				return true;
+			else if( ch == '$' )
+			{
+				r += run;
+				c = 0;
+			}
+			else if( ch == 'b' || ch == '.' )
+				c += run;
+			else if( isalpha( (unsigned char)ch ) )
+			{
+				for( long long k = 0; k < run; k++ )
+					if( !addCell( row + r, col + c + k ) )
+						return false;
+				c += run;
+			}
+			else
+				return false;
+		}
+	}
+	return body;
+}
+
+/********************************************************************************
+*	Function: parsePlain( const std::string &, int, int )
+*	Description: Reads the live cells of a plaintext pattern, one row per line,
+*		'O', 'o', '*' or '0' alive and '.' or a space dead. Lines starting with '!'
+*		are comments.
+*	Parameters: The pattern and the board row and column of its top left
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if a character is not a cell or a live cell is
+*		off the board. The cells are in patternRows and patternCols.
+* ******************************************************************************/
+bool Simulation::Impl::parsePlain( const std::string &text, int row, int col )
+{
+	std::istringstream in( text );
+	std::string line;
+	long long r = 0;
+
+	while( std::getline( in, line ) )
+	{
+		if( !line.empty() && line[0] == '!' )
+			continue;
+		for( size_t i = 0; i < line.size(); i++ )
+		{
+			char ch = line[i];
+			if( ch == 'O' || ch == 'o' || ch == '*' || ch == '0' )
+			{
+				if( !addCell( row + r, col + (long long)i ) )
+					return false;
+			}
+			else if( ch != '.' && ch != ' ' && ch != '\t' && ch != '\r' )
+				return false;
+		}
+		r++;
+	}
+	return true;
+}
+
+/********************************************************************************
+*	Function: loadPattern( const std::string &, int, int )
+*	Description: Adds the live cells of a pattern to the board. Accepts RLE,
+*		with or without its "x = , y = , rule = " header, and plaintext, where
+*		each line is a row, 'O', 'o', '*' or '0' alive and '.' dead, and lines
+*		starting with '!' are comments. A rule in an RLE header is set.
+*	Parameters: The pattern, and the board row and column of its top left cell
+*	Pre-Conditions: None
+*	Post-Conditions: returns false and leaves the board unchanged if the text
+*		is not a pattern, its rule cannot be run, or a live cell is off the
+*		board
+* ******************************************************************************/
+bool Simulation::loadPattern( const std::string &text, int row, int col )
+{
+	std::istringstream in( text );
+	std::string line, headerRule;
+	bool plain = true;
+	bool ok;
+
+	//Plaintext is only cells and '!' comments, RLE has '$', 'b', '!' or a header
+	while( std::getline( in, line ) )
+		if( !line.empty() && line[0] != '!'
+				&& line.find_first_not_of( ".Oo*0 \t\r" ) != std::string::npos )
+			plain = false;
+
+	impl->patternRows.clear();
+	impl->patternCols.clear();
+	ok = plain ? impl->parsePlain( text, row, col )
+			: impl->parseRle( text, row, col, headerRule );
+	if( ok && !headerRule.empty() && headerRule != impl->rule )
+		ok = setRule( headerRule );
+
+	if( ok )
+		for( size_t i = 0; i < impl->patternRows.size(); i++ )
+			impl->board.setCell( impl->patternRows[i], impl->patternCols[i], true );
+	impl->patternRows.clear();
+	impl->patternCols.clear();
+	return ok;
+}
+
+/********************************************************************************
+*	Function: loadFile( const std::string &, int, int )
+*	Description: Reads a pattern file and adds it as loadPattern does
+*	Parameters: The file name, and the board row and column of its top left
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the file cannot be read or loaded
+* ******************************************************************************/
+bool Simulation::loadFile( const std::string &name, int row, int col )
+{
+	std::ifstream in( name.c_str(), std::ios::binary );
+
+	if( !in )
+		return false;
+	std::string text( (std::istreambuf_iterator<char>( in )), std::istreambuf_iterator<char>() );
+	return loadPattern( text, row, col );
+}
+
+/********************************************************************************
+*	Function: clear()
+*	Description: Sets every cell to dead and starts again from generation 0
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: The board is empty and the statistics are zeroed
+* ******************************************************************************/
+void Simulation::clear()
+{
+	impl->board.clear();
+	impl->generation = 0;
+	impl->stepSeconds = 0;
+}
+
+/********************************************************************************
+*	Function: randomize( uint64_t, double )
+*	Description: Fills the board with a random soup and starts again from
+*		generation 0
+*	Parameters: The seed and the share of cells alive, 0 to 1
+*	Pre-Conditions: None
+*	Post-Conditions: The same seed and density always give the same board
+* ******************************************************************************/
+void Simulation::randomize( uint64_t seed, double density )
+{
+	Soup( seed, density ).fill( impl->board );
+	impl->generation = 0;
+	impl->stepSeconds = 0;
+}
+
+/********************************************************************************
+*	Function: step( int )
+*	Description: Advances the board a number of generations with the engine
+*	Parameters: The number of generations
+*	Pre-Conditions: None
+*	Post-Conditions: The board is that many generations later, and handed to
+*		the frame writer if frames are being written. Views taken before the
+*		call must be taken again.
+* ******************************************************************************/
+void Simulation::step( int generations )
+{
+	if( generations <= 0 )
+		return;
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	impl->engine->advance( impl->board, generations );
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	impl->generation += generations;
+	impl->stepSeconds += std::chrono::duration<double>( end - begin ).count();
+
+	//The board is copied, so stepping goes on while the frame is written
+	if( impl->frames )
+		impl->frames->submit( impl->board, impl->generation );
+}
+
+/********************************************************************************
+*	Function: writeFrames( const std::string &, int )
+*	Description: Starts writing frames of the board: the board as it is now,
+*		then the board after every step(). Frames are written in the
+*		background and named by framePath(). Frames already being written
+*		are finished first.
+*	Parameters: The file name prefix, and the format, SIM_FRAME_RLE,
+*		SIM_FRAME_BINARY or SIM_FRAME_PGM
+*	Pre-Conditions: None
+*	Post-Conditions: returns false, and writes no more frames, if the format is
+*		unknown or the first frame could not be written
+* ******************************************************************************/
+bool Simulation::writeFrames( const std::string &prefix, int format )
+{
+	stopFrames();
+	if( format != FRAME_RLE && format != FRAME_BINARY && format != FRAME_PGM )
+		return false;
+
+	impl->frames = new FrameWriter( prefix, format );
+	impl->frames->setRule( impl->rule );
+
+	//Waiting for the first frame finds a prefix that cannot be written at once
+	if( !impl->frames->submit( impl->board, impl->generation ) || !impl->frames->flush() )
+	{
+		stopFrames();
+		return false;
+	}
+	return true;
+}
+
+/********************************************************************************
+*	Function: stopFrames()
+*	Description: Writes every frame still waiting and stops writing frames
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if any frame could not be written
+* ******************************************************************************/
+bool Simulation::stopFrames()
+{
+	bool written = true;
+
+	if( impl->frames )
+	{
+		written = impl->frames->flush();
+		delete impl->frames;
+		impl->frames = NULL;
+	}
+	return written;
+}
+
+/********************************************************************************
+*	Function: render( std::ostream & )
+*	Description: Brings the viewport up to date with the tiles changed since
+*		it was last drawn and draws its window of the board
+*	Parameters: The stream to draw to
+*	Pre-Conditions: None
+*	Post-Conditions: The window is written, see Viewport::render
+* ******************************************************************************/
+void Simulation::render( std::ostream &out )
+{
+	impl->viewport.update( impl->board );
+	impl->viewport.render( impl->board, out );
+}
+
+/********************************************************************************
+*	Function: setCell( int, int, bool ), getCell( int, int )
+*	Description: Sets or returns one cell. Cells off the board are ignored
+*		and read as dead.
+*	Parameters: The row and column, and whether the cell is alive
+*	Pre-Conditions: None
+*	Post-Conditions: The cell is set or returned
+* ******************************************************************************/
+void Simulation::setCell( int r, int c, bool alive )
+{
+	impl->board.setCell( r, c, alive );
+}
+
+bool Simulation::getCell( int r, int c ) const
+{
+	return impl->board.getCell( r, c );
+}
+
+bool Simulation::writingFrames() const
+{
+	return impl->frames != NULL;
+}
+
+/********************************************************************************
+*	Function: framePath( const std::string &, int, long long )
+*	Description: Returns the name of the file a generation's frame is written to
+*	Parameters: The file name prefix, the format and the generation
+*	Pre-Conditions: None
+*	Post-Conditions: returns the prefix, the generation and the format's suffix
+* ******************************************************************************/
+std::string Simulation::framePath( const std::string &prefix, int format, long long generation )
+{
+	return FrameWriter::framePath( prefix, format, generation );
+}
+
+/********************************************************************************
+*	Function: view()
+*	Description: Returns a read-only view of the packed board, copying nothing
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: The view is good until the next step()
+* ******************************************************************************/
+GridView Simulation::view() const
+{
+	return GridView( impl->board );
+}
+
+/********************************************************************************
+*	Function: pan( long long, long long ), setZoom( int ),
+*		center( long long, long long )
+*	Description: Moves the window by a number of characters at the current
+*		zoom, zooms it keeping its center in place, or moves it so a cell is
+*		in its center. Zoom is clamped to 0 through VIEW_MAX_ZOOM.
+*	Parameters: The rows and columns to move, negative for up and left; the
+*		zoom, each character covering 2^zoom X 2^zoom cells; or the row and
+*		column of the cell
+*	Pre-Conditions: None
+*	Post-Conditions: The window is moved or zoomed
+* ******************************************************************************/
+void Simulation::pan( long long rows, long long cols )
+{
+	impl->viewport.pan( rows, cols );
+}
+
+void Simulation::setZoom( int zoom )
+{
+	impl->viewport.setZoom( zoom );
+}
+
+void Simulation::center( long long r, long long c )
+{
+	impl->viewport.center( r, c );
+}
+
+/********************************************************************************
+*	Function: getZoom(), getTop(), getLeft(), getViewHeight(), getViewWidth()
+*	Description: The window: its zoom, the board row and column at its top
+*		left, and its rows and columns of characters
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns the value
+* ******************************************************************************/
+int Simulation::getZoom() const
+{
+	return impl->viewport.getZoom();
+}
+
+long long Simulation::getTop() const
+{
+	return impl->viewport.getTop();
+}
+
+long long Simulation::getLeft() const
+{
+	return impl->viewport.getLeft();
+}
+
+int Simulation::getViewHeight() const
+{
+	return impl->viewport.getHeight();
+}
+
+int Simulation::getViewWidth() const
+{
+	return impl->viewport.getWidth();
+}
+
+/********************************************************************************
+*	Function: getGeneration(), getPopulation(), getStepSeconds()
+*	Description: Statistics: generations stepped, live cells, and the time
+*		spent stepping since the board was last cleared or randomized
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns the statistic
+* ******************************************************************************/
+long long Simulation::getGeneration() const
+{
+	return impl->generation;
+}
+
+long long Simulation::getPopulation() const
+{
+	return impl->board.population();
+}
+
+double Simulation::getStepSeconds() const
+{
+	return impl->stepSeconds;
+}
+
+const std::string &Simulation::getEngineName() const
+{
+	return impl->engineName;
+}
+
+const std::string &Simulation::getRule() const
+{
+	return impl->rule;
+}
+
+int Simulation::getRows() const
+{
+	return impl->board.getRows();
+}
+
+int Simulation::getCols() const
+{
+	return impl->board.getCols();
+}
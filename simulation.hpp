@@ -0,0 +1,261 @@
+/******************************************************************************
+ ** Program Filename: simulation.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the Simulation class, the entry
+			point of the gol library for programs that embed the Game of Life.
+			A Simulation owns a board and the engine that steps it: create
+			one, load patterns in RLE or plaintext form, pick an engine and
+			a rule, step it, and read its statistics. view() returns a
+			GridView of the packed board without copying it, and a window
+			kept up to date from the board's changed tiles draws it at any
+			zoom. Engines are chosen by name: "sweep", "temporal" and
+			"parallel" run Life, and "ltl" runs Larger-than-Life rules.
+			writeFrames() hands the board after every step to a writer that
+			writes the frames in the background. gol.h wraps this class in a
+			C interface.
+			The board, engine, window and writer live behind a pointer to
+			an Impl declared only in simulation.cpp, so programs built
+			against libgol.so do not depend on their layout.
+ ** Input: Patterns as RLE or plaintext
+ ** Output: The board, its statistics, windows of it, and frame files
+ * ***************************************************************************/
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+#include <ostream>
+#include <string>
+#include "gridview.hpp"
+
+#define SIM_LIFE "B3/S23"		//Rule of Conway's Life, run by every engine
+#define SIM_ENGINE "sweep"		//Engine a Simulation starts with
+
+//Formats of writeFrames(), the same as writer.hpp's
+#define SIM_FRAME_RLE 0			//RLE pattern with a generation comment
+#define SIM_FRAME_BINARY 1		//Header then the packed rows
+#define SIM_FRAME_PGM 2			//Greyscale image, live cells black
+
+//Simulation Class Declaration
+class Simulation
+{
+	private:
+		struct Impl;
+		Impl *impl;			//Board, engine, window and writer, owned
+
+		Simulation( const Simulation & );
+		Simulation &operator=( const Simulation & );
+
+	public:
+		/********************************************************************************
+		*	Function: Simulation( int, int, int )
+		*	Description: Constructor of an empty board stepped by the sweep under Life
+		*	Parameters: The rows and columns of the board, and the threads the parallel
+		*		engines use, 0 for one per core
+		*	Pre-Conditions: rows and columns should not be negative
+		*	Post-Conditions: Every cell is dead and the generation is 0
+		* ******************************************************************************/
+		Simulation( int, int, int = 0 );
+
+		/********************************************************************************
+		*	Function: ~Simulation()
+		*	Description: Destructor, frees the engine and finishes writing frames
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: The engine is freed and every frame is on disk
+		* ******************************************************************************/
+		~Simulation();
+
+		/********************************************************************************
+		*	Function: setEngine( const std::string & )
+		*	Description: Chooses the engine that steps the board: "sweep", "temporal",
+		*		"parallel" or "ltl". Life is run by every engine, other rules only by
+		*		"ltl".
+		*	Parameters: The engine's name
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false and keeps the engine if the name is unknown
+		*		or the engine cannot run the rule
+		* ******************************************************************************/
+		bool setEngine( const std::string & );
+
+		/********************************************************************************
+		*	Function: setRule( const std::string & )
+		*	Description: Sets the rule. "B3/S23", "S23/B3", "23/3" and Larger-than-Life
+		*		rules that step as Life does, such as LTL_LIFE, are Life, kept with the
+		*		current engine unless that is "ltl", which is replaced by the sweep.
+		*		Any other Larger-than-Life rule in Golly's form, such as
+		*		"R5,C0,M1,S34..58,B34..45,NM", switches to the "ltl" engine.
+		*	Parameters: The rule string
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false and leaves the rule unchanged if the string
+		*		is not a rule the engines run
+		* ******************************************************************************/
+		bool setRule( const std::string & );
+
+		/********************************************************************************
+		*	Function: loadPattern( const std::string &, int, int )
+		*	Description: Adds the live cells of a pattern to the board. Accepts RLE,
+		*		with or without its "x = , y = , rule = " header, and plaintext, where
+		*		each line is a row, 'O', 'o', '*' or '0' alive and '.' dead, and lines
+		*		starting with '!' are comments. A rule in an RLE header is set.
+		*	Parameters: The pattern, and the board row and column of its top left cell
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false and leaves the board unchanged if the text
+		*		is not a pattern, its rule cannot be run, or a live cell is off the
+		*		board
+		* ******************************************************************************/
+		bool loadPattern( const std::string &, int, int );
+
+		/********************************************************************************
+		*	Function: loadFile( const std::string &, int, int )
+		*	Description: Reads a pattern file and adds it as loadPattern does
+		*	Parameters: The file name, and the board row and column of its top left
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false if the file cannot be read or loaded
+		* ******************************************************************************/
+		bool loadFile( const std::string &, int, int );
+
+		/********************************************************************************
+		*	Function: setCell( int, int, bool ), getCell( int, int )
+		*	Description: Sets or returns one cell. Cells off the board are ignored
+		*		and read as dead.
+		*	Parameters: The row and column, and whether the cell is alive
+		*	Pre-Conditions: None
+		*	Post-Conditions: The cell is set or returned
+		* ******************************************************************************/
+		void setCell( int, int, bool );
+		bool getCell( int, int ) const;
+
+		/********************************************************************************
+		*	Function: clear()
+		*	Description: Sets every cell to dead and starts again from generation 0
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: The board is empty and the statistics are zeroed
+		* ******************************************************************************/
+		void clear();
+
+		/********************************************************************************
+		*	Function: randomize( uint64_t, double )
+		*	Description: Fills the board with a random soup and starts again from
+		*		generation 0
+		*	Parameters: The seed and the share of cells alive, 0 to 1
+		*	Pre-Conditions: None
+		*	Post-Conditions: The same seed and density always give the same board
+		* ******************************************************************************/
+		void randomize( uint64_t, double );
+
+		/********************************************************************************
+		*	Function: step( int )
+		*	Description: Advances the board a number of generations with the engine
+		*	Parameters: The number of generations
+		*	Pre-Conditions: None
+		*	Post-Conditions: The board is that many generations later, and handed to
+		*		the frame writer if frames are being written. Views taken before the
+		*		call must be taken again.
+		* ******************************************************************************/
+		void step( int = 1 );
+
+		/********************************************************************************
+		*	Function: writeFrames( const std::string &, int )
+		*	Description: Starts writing frames of the board: the board as it is now,
+		*		then the board after every step(). Frames are written in the
+		*		background and named by framePath(). Frames already being written
+		*		are finished first.
+		*	Parameters: The file name prefix, and the format, SIM_FRAME_RLE,
+		*		SIM_FRAME_BINARY or SIM_FRAME_PGM
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false, and writes no more frames, if the format is
+		*		unknown or the first frame could not be written
+		* ******************************************************************************/
+		bool writeFrames( const std::string &, int );
+
+		/********************************************************************************
+		*	Function: stopFrames()
+		*	Description: Writes every frame still waiting and stops writing frames
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false if any frame could not be written
+		* ******************************************************************************/
+		bool stopFrames();
+
+		bool writingFrames() const;
+
+		/********************************************************************************
+		*	Function: framePath( const std::string &, int, long long )
+		*	Description: Returns the name of the file a generation's frame is written to
+		*	Parameters: The file name prefix, the format and the generation
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the prefix, the generation and the format's suffix
+		* ******************************************************************************/
+		static std::string framePath( const std::string &, int, long long );
+
+		/********************************************************************************
+		*	Function: view()
+		*	Description: Returns a read-only view of the packed board, copying nothing
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: The view is good until the next step()
+		* ******************************************************************************/
+		GridView view() const;
+
+		/********************************************************************************
+		*	Function: render( std::ostream & )
+		*	Description: Brings the window up to date with the tiles changed since it
+		*		was last drawn and draws it. At zoom 0 live cells are '0' and dead
+		*		cells '.'. Zoomed out, each character is the glyph for the density of
+		*		its block. Characters off the board are blank.
+		*	Parameters: The stream to draw to
+		*	Pre-Conditions: None
+		*	Post-Conditions: getViewHeight() lines of getViewWidth() characters are
+		*		written
+		* ******************************************************************************/
+		void render( std::ostream & );
+
+		/********************************************************************************
+		*	Function: pan( long long, long long ), setZoom( int ),
+		*		center( long long, long long )
+		*	Description: Moves the window by a number of characters at the current
+		*		zoom, zooms it keeping its center in place, or moves it so a cell is
+		*		in its center. Zoom is clamped to 0 through VIEW_MAX_ZOOM.
+		*	Parameters: The rows and columns to move, negative for up and left; the
+		*		zoom, each character covering 2^zoom X 2^zoom cells; or the row and
+		*		column of the cell
+		*	Pre-Conditions: None
+		*	Post-Conditions: The window is moved or zoomed
+		* ******************************************************************************/
+		void pan( long long, long long );
+		void setZoom( int );
+		void center( long long, long long );
+
+		/********************************************************************************
+		*	Function: getZoom(), getTop(), getLeft(), getViewHeight(), getViewWidth()
+		*	Description: The window: its zoom, the board row and column at its top
+		*		left, and its rows and columns of characters
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the value
+		* ******************************************************************************/
+		int getZoom() const;
+		long long getTop() const;
+		long long getLeft() const;
+		int getViewHeight() const;
+		int getViewWidth() const;
+
+		/********************************************************************************
+		*	Function: getGeneration(), getPopulation(), getStepSeconds()
+		*	Description: Statistics: generations stepped, live cells, and the time
+		*		spent stepping since the board was last cleared or randomized
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the statistic
+		* ******************************************************************************/
+		long long getGeneration() const;
+		long long getPopulation() const;
+		double getStepSeconds() const;
+
+		const std::string &getEngineName() const;
+		const std::string &getRule() const;
+		int getRows() const;
+		int getCols() const;
+};
+
+#endif
@@ -0,0 +1,172 @@
+/******************************************************************************
+ ** Program Filename: soup.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the Soup class function implementation file
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#include <functional>
+#include <thread>
+#include <vector>
+#include "soup.hpp"
+
+/********************************************************************************
+*	Function: philox( uint32_t[4], uint64_t )
+*	Description: Runs the 10 rounds of Philox4x32 on a counter with a key
+*	Parameters: The 4 word counter, replaced by the random output, and the key
+*	Pre-Conditions: None
+*	Post-Conditions: The counter holds 128 random bits
+* ******************************************************************************/
+static inline void philox( uint32_t ctr[4], uint64_t key )
+{
+	uint32_t k0 = (uint32_t)key;
+	uint32_t k1 = (uint32_t)(key >> 32);
+
+	for( int round = 0; round < 10; round++ )
+	{
+		uint64_t p0 = (uint64_t)0xD2511F53 * ctr[0];
+		uint64_t p1 = (uint64_t)0xCD9E8D57 * ctr[2];
+		uint32_t c0 = (uint32_t)(p1 >> 32) ^ ctr[1] ^ k0;
+		uint32_t c2 = (uint32_t)(p0 >> 32) ^ ctr[3] ^ k1;
+		ctr[0] = c0;
+		ctr[1] = (uint32_t)p1;
+		ctr[2] = c2;
+		ctr[3] = (uint32_t)p0;
+		k0 += 0x9E3779B9;
+		k1 += 0xBB67AE85;
+	}
+}
+
+/********************************************************************************
+*	Function: Soup( uint64_t, double )
+*	Description: Constructor of a soup with a seed and a density
+*	Parameters: The seed and the fraction of cells that should be alive. The
+*		density is clamped to 0 through 1.
+*	Pre-Conditions: None
+*	Post-Conditions: The soup is ready to fill grids
+* ******************************************************************************/
+Soup::Soup( uint64_t s, double density )
+{
+	seed = s;
+	if( !(density > 0) )
+		density = 0;
+	else if( density > 1 )
+		density = 1;
+	level = (int)( density * (1 << SOUP_DENSITY_BITS) + 0.5 );
+}
+
+/********************************************************************************
+*	Function: fillBand( Grid &, int, int )
+*	Description: Fills a band of rows with random words. Each word is built from
+*		random words one density bit at a time, from the lowest set bit up: a 1
+*		bit ORs in a random word and a 0 bit ANDs one in, so each cell ends up
+*		alive with exactly the rounded density.
+*	Parameters: The grid, the first row, and the row after the last
+*	Pre-Conditions: The band is inside the grid
+*	Post-Conditions: The band holds the soup and its tiles are marked changed
+* ******************************************************************************/
+void Soup::fillBand( Grid &grid, int r0, int r1 ) const
+{
+	int words = grid.getRowWords();
+	int lowest = 0;
+
+	if( level > 0 && level < (1 << SOUP_DENSITY_BITS) )
+		while( !((level >> lowest) & 1) )
+			lowest++;
+
+	for( int r = r0; r < r1; r++ )
+	{
+		uint64_t *row = grid.row( r );
+
+		//Mark each tile the band touches once, at its first row in the band
+		if( r == r0 || r % TILE_ROWS == 0 )
+			for( int w = 0; w < words; w++ )
+				grid.markChanged( r, w );
+
+		for( int w = 0; w < words; w++ )
+		{
+			if( level == 0 || level == (1 << SOUP_DENSITY_BITS) )
+			{
+				row[w] = level ? ~(uint64_t)0 : 0;
+				continue;
+			}
+
+			uint64_t cell = 0;
+			uint32_t ctr[4];
+			for( int bit = lowest, draw = 0; bit < SOUP_DENSITY_BITS; bit++, draw++ )
+			{
+				//Each Philox block gives two random words
+				if( draw % 2 == 0 )
+				{
+					ctr[0] = (uint32_t)w;
+					ctr[1] = (uint32_t)r;
+					ctr[2] = (uint32_t)(draw / 2);
+					ctr[3] = 0;
+					philox( ctr, seed );
+				}
+				int half = (draw % 2) * 2;
+				uint64_t random = ctr[half] | ((uint64_t)ctr[half+1] << 32);
+
+				if( (level >> bit) & 1 )
+					cell |= random;
+				else
+					cell &= random;
+			}
+			row[w] = cell;
+		}
+		row[words-1] &= grid.getLastMask();
+	}
+}
+
+/********************************************************************************
+*	Function: fillRows( Grid &, int, int )
+*	Description: Replaces the cells of a band of rows with the soup. The cells
+*		are the same as fill() would put there.
+*	Parameters: The grid, the first row, and the row after the last
+*	Pre-Conditions: None
+*	Post-Conditions: The rows of the band inside the grid hold the soup and
+*		their tiles are marked changed
+* ******************************************************************************/
+void Soup::fillRows( Grid &grid, int r0, int r1 ) const
+{
+	if( r0 < 0 )
+		r0 = 0;
+	if( r1 > grid.getRows() )
+		r1 = grid.getRows();
+	if( r0 < r1 && grid.getRowWords() > 0 )
+		fillBand( grid, r0, r1 );
+}
+
+/********************************************************************************
+*	Function: fill( Grid &, int )
+*	Description: Replaces every cell of a grid with the soup. Each thread fills
+*		whole tiles, so no two threads mark the same tile of the change map.
+*	Parameters: The grid and the number of threads to use, 0 for one per core
+*	Pre-Conditions: None
+*	Post-Conditions: The grid holds the soup for this seed and density, and
+*		every tile is marked changed
+* ******************************************************************************/
+void Soup::fill( Grid &grid, int threads ) const
+{
+	int rows = grid.getRows();
+	int tiles = grid.getTileRows();
+
+	if( threads <= 0 )
+		threads = (int)std::thread::hardware_concurrency();
+	if( threads > tiles )
+		threads = tiles;
+	if( threads <= 1 )
+	{
+		fillRows( grid, 0, rows );
+		return;
+	}
+
+	std::vector<std::thread> workers;
+	for( int t = 0; t < threads; t++ )
+		workers.push_back( std::thread( &Soup::fillRows, this, std::ref( grid ),
+				(int)((long long)tiles * t / threads) * TILE_ROWS,
+				(int)((long long)tiles * (t + 1) / threads) * TILE_ROWS ) );
+	for( int t = 0; t < threads; t++ )
+		workers[t].join();
+}
@@ -0,0 +1,78 @@
+/******************************************************************************
+ ** Program Filename: soup.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the Soup class. A Soup fills a
+			Grid with random live cells at a density, a whole word of cells at
+			a time. The random numbers come from the Philox4x32-10 counter
+			based generator keyed by the seed, with the row and word as the
+			counter, so every word is computed on its own. The board is split
+			into bands of whole tiles filled by parallel threads, which mark
+			the tiles they fill changed, and the same seed and density always
+			give the same board whatever the thread count.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef SOUP_HPP
+#define SOUP_HPP
+#include "grid.hpp"
+
+#define SOUP_DENSITY_BITS 8	//Density is rounded to a multiple of 1/256
+
+//Soup Class Declaration
+class Soup
+{
+	private:
+		uint64_t seed;	 //Key of the generator
+		int level;		 //Density in 1/256ths, 0 to 256
+
+		void fillBand( Grid &, int, int ) const;
+
+	public:
+		/********************************************************************************
+		*	Function: Soup( uint64_t, double )
+		*	Description: Constructor of a soup with a seed and a density
+		*	Parameters: The seed and the fraction of cells that should be alive. The
+		*		density is clamped to 0 through 1.
+		*	Pre-Conditions: None
+		*	Post-Conditions: The soup is ready to fill grids
+		* ******************************************************************************/
+		Soup( uint64_t = 1, double = 0.5 );
+
+		/********************************************************************************
+		*	Function: fill( Grid &, int )
+		*	Description: Replaces every cell of a grid with the soup. Each thread fills
+		*		whole tiles, so no two threads mark the same tile of the change map.
+		*	Parameters: The grid and the number of threads to use, 0 for one per core
+		*	Pre-Conditions: None
+		*	Post-Conditions: The grid holds the soup for this seed and density, and
+		*		every tile is marked changed
+		* ******************************************************************************/
+		void fill( Grid &, int = 0 ) const;
+
+		/********************************************************************************
+		*	Function: fillRows( Grid &, int, int )
+		*	Description: Replaces the cells of a band of rows with the soup. The cells
+		*		are the same as fill() would put there.
+		*	Parameters: The grid, the first row, and the row after the last
+		*	Pre-Conditions: None
+		*	Post-Conditions: The rows of the band inside the grid hold the soup and
+		*		their tiles are marked changed
+		* ******************************************************************************/
+		void fillRows( Grid &, int, int ) const;
+
+		uint64_t getSeed() const
+		{ return seed; }
+
+		/********************************************************************************
+		*	Function: getDensity()
+		*	Description: Returns the density after rounding
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the expected fraction of live cells
+		* ******************************************************************************/
+		double getDensity() const
+		{ return level / (double)(1 << SOUP_DENSITY_BITS); }
+};
+
+#endif
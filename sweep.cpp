@@ -0,0 +1,50 @@
+/******************************************************************************
+ ** Program Filename: sweep.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the SweepEngine class function implementation file
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#include "sweep.hpp"
+
+/********************************************************************************
+*	Function: advance( Grid &, int )
+*	Description: Advances every cell of a grid by a number of generations,
+*		sweeping the whole board once per generation
+*	Parameters: The grid to update and the number of generations
+*	Pre-Conditions: generations should not be negative
+*	Post-Conditions: The grid holds the board that many generations later and
+*		every tile that changed is marked
+* ******************************************************************************/
+void SweepEngine::advance( Grid &grid, int generations )
+{
+	int rows = grid.getRows();
+	int words = grid.getRowWords();
+
+	if( rows == 0 || words == 0 )
+		return;
+	if( next.getRows() != rows || next.getCols() != grid.getCols() )
+		next.resize( rows, grid.getCols() );
+	zeros.assign( words, 0 );
+
+	for( int g = 0; g < generations; g++ )
+	{
+		for( int i = 0; i < rows; i++ )
+		{
+			const uint64_t *above = i > 0 ? grid.row( i-1 ) : &zeros[0];
+			const uint64_t *below = i + 1 < rows ? grid.row( i+1 ) : &zeros[0];
+			lifeRow( above, grid.row( i ), below, next.row( i ), words,
+					grid.getLastMask() );
+
+			//The row is still in cache, so finding the changed words is cheap
+			for( int w = 0; w < words; w++ )
+				if( next.row( i )[w] != grid.row( i )[w] )
+					grid.markChanged( i, w );
+		}
+
+		//The whole board is read once and written once per generation
+		trafficBytes += 2 * (long long)grid.bytes();
+		grid.swap( next );
+	}
+}
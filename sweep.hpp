@@ -0,0 +1,40 @@
+/******************************************************************************
+ ** Program Filename: sweep.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the SweepEngine class. It steps
+			a Grid one generation per pass over the whole board, the same
+			order Cells::advanceGeneration uses, but 64 cells at a time. It is
+			the baseline the other engines are measured against.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+#include <vector>
+#include "engine.hpp"
+
+//SweepEngine Class Declaration
+class SweepEngine : public Engine
+{
+	private:
+		Grid next;					 //Board the next generation is written to
+		std::vector<uint64_t> zeros; //Dead row used above and below the board
+
+	public:
+		/********************************************************************************
+		*	Function: advance( Grid &, int )
+		*	Description: Advances every cell of a grid by a number of generations,
+		*		sweeping the whole board once per generation
+		*	Parameters: The grid to update and the number of generations
+		*	Pre-Conditions: generations should not be negative
+		*	Post-Conditions: The grid holds the board that many generations later and
+		*		every tile that changed is marked
+		* ******************************************************************************/
+		void advance( Grid &, int );
+
+		const char *getName() const
+		{ return "sweep"; }
+};
+
+#endif
@@ -0,0 +1,145 @@
+/******************************************************************************
+ ** Program Filename: temporal.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the TemporalEngine class function implementation file
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#include <algorithm>
+#include <cstring>
+#include "temporal.hpp"
+
+/********************************************************************************
+*	Function: TemporalEngine( int, int, int )
+*	Description: Constructor of a temporally blocked engine. Values less than 1
+*		are raised to 1.
+*	Parameters: The generations per pass (k), the rows in a tile and the words
+*		across a tile
+*	Pre-Conditions: None
+*	Post-Conditions: The engine is ready to advance grids
+* ******************************************************************************/
+TemporalEngine::TemporalEngine( int k, int rowsPerTile, int wordsPerTile )
+{
+	depth = k < 1 ? 1 : k;
+	tileRows = rowsPerTile < 1 ? 1 : rowsPerTile;
+	tileWords = wordsPerTile < 1 ? 1 : wordsPerTile;
+}
+
+/********************************************************************************
+*	Function: advanceTile( Grid &, Grid &, int, int, int )
+*	Description: Loads one tile of a board and its halo into the buffers,
+*		advances it a number of generations, and writes the tile to a second
+*		board. Words of the tile that changed are marked on the first board.
+*	Parameters: The board to read, the board to write, the first row and first
+*		word of the tile, and the number of generations
+*	Pre-Conditions: Both boards are the same size. The halo is the number of
+*		generations deep in rows and enough whole words to cover as many columns.
+*	Post-Conditions: The tile of the second board is that many generations on
+* ******************************************************************************/
+void TemporalEngine::advanceTile( Grid &src, Grid &dst, int r0, int w0, int k )
+{
+	int rows = src.getRows();
+	int words = src.getRowWords();
+	int r1 = std::min( r0 + tileRows, rows );
+	int w1 = std::min( w0 + tileWords, words );
+	int haloWords = (k + WORD_BITS - 1) / WORD_BITS;
+
+	//Tile plus halo, clipped to the board. Cells past a clipped edge are
+	//	outside the board and so correctly dead.
+	int lr0 = std::max( 0, r0 - k );
+	int lr1 = std::min( rows, r1 + k );
+	int lw0 = std::max( 0, w0 - haloWords );
+	int lw1 = std::min( words, w1 + haloWords );
+	int nr = lr1 - lr0;
+	int nw = lw1 - lw0;
+	uint64_t mask = lw1 == words ? src.getLastMask() : ~(uint64_t)0;
+
+	size_t need = (size_t)nr * nw;
+	if( bufferA.size() < need )
+	{
+		bufferA.resize( need );
+		bufferB.resize( need );
+	}
+	if( (int)zeros.size() < nw )
+		zeros.assign( nw, 0 );
+
+	for( int i = 0; i < nr; i++ )
+		memcpy( &bufferA[(size_t)i * nw], src.row( lr0 + i ) + lw0, nw * sizeof(uint64_t) );
+	trafficBytes += (long long)need * sizeof(uint64_t);
+
+	uint64_t *cur = &bufferA[0];
+	uint64_t *nxt = &bufferB[0];
+
+	//Step g only needs the rows step g+1 will read, so the computed band
+	//	narrows by one row on each side per step until it is the tile itself
+	for( int g = 1; g <= k; g++ )
+	{
+		int from = std::max( lr0, r0 - (k - g) );
+		int to = std::min( lr1, r1 + (k - g) );
+
+		for( int x = from; x < to; x++ )
+		{
+			size_t li = (size_t)(x - lr0);
+			const uint64_t *above = x - 1 >= lr0 ? cur + (li - 1) * nw : &zeros[0];
+			const uint64_t *below = x + 1 < lr1 ? cur + (li + 1) * nw : &zeros[0];
+			lifeRow( above, cur + li * nw, below, nxt + li * nw, nw, mask );
+		}
+		std::swap( cur, nxt );
+	}
+
+	//The tile's old cells are still in cache, so finding the changed words is cheap
+	for( int x = r0; x < r1; x++ )
+	{
+		const uint64_t *out = cur + (size_t)(x - lr0) * nw + (w0 - lw0);
+
+		for( int w = w0; w < w1; w++ )
+			if( out[w - w0] != src.row( x )[w] )
+				src.markChanged( x, w );
+		memcpy( dst.row( x ) + w0, out, (w1 - w0) * sizeof(uint64_t) );
+	}
+	trafficBytes += (long long)(r1 - r0) * (w1 - w0) * sizeof(uint64_t);
+}
+
+/********************************************************************************
+*	Function: pass( Grid &, int )
+*	Description: Advances every tile of a grid by a number of generations in one
+*		pass over the board
+*	Parameters: The grid to update and the number of generations
+*	Pre-Conditions: The back board is the size of the grid
+*	Post-Conditions: The grid holds the board that many generations later and
+*		every tile that changed is marked
+* ******************************************************************************/
+void TemporalEngine::pass( Grid &grid, int k )
+{
+	for( int r0 = 0; r0 < grid.getRows(); r0 += tileRows )
+		for( int w0 = 0; w0 < grid.getRowWords(); w0 += tileWords )
+			advanceTile( grid, next, r0, w0, k );
+
+	grid.swap( next );
+}
+
+/********************************************************************************
+*	Function: advance( Grid &, int )
+*	Description: Advances every cell of a grid by a number of generations,
+*		depth generations per pass over the board. A last partial pass covers
+*		any remainder.
+*	Parameters: The grid to update and the number of generations
+*	Pre-Conditions: generations should not be negative
+*	Post-Conditions: The grid holds the board that many generations later and
+*		every tile that changed is marked
+* ******************************************************************************/
+void TemporalEngine::advance( Grid &grid, int generations )
+{
+	if( grid.getRows() == 0 || grid.getRowWords() == 0 )
+		return;
+	if( next.getRows() != grid.getRows() || next.getCols() != grid.getCols() )
+		next.resize( grid.getRows(), grid.getCols() );
+
+	while( generations > 0 )
+	{
+		int k = std::min( depth, generations );
+		pass( grid, k );
+		generations -= k;
+	}
+}
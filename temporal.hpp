@@ -0,0 +1,78 @@
+/******************************************************************************
+ ** Program Filename: temporal.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the TemporalEngine class. It
+			steps a Grid with temporal blocking: the board is cut into tiles,
+			and each tile is copied into a cache sized buffer together with a
+			halo of depth cells on every side, advanced depth generations in
+			the buffer, and only then written back. Each generation a cell can
+			only be affected by cells one step further away, so after depth
+			generations the halo has absorbed every wrong value from the
+			buffer's edges and the tile itself is exact. The rows computed at
+			each step shrink toward the tile (a trapezoid), so the halo is not
+			recomputed more than needed. The board then moves through main
+			memory once per depth generations instead of once per generation.
+ ** Input: None
+ ** Output: None
+ * ***************************************************************************/
+#ifndef TEMPORAL_HPP
+#define TEMPORAL_HPP
+#include <vector>
+#include "engine.hpp"
+
+#define TEMPORAL_DEPTH 8	   //Default generations advanced per pass
+#define TEMPORAL_TILE_ROWS 128 //Default rows in a tile
+#define TEMPORAL_TILE_WORDS 16 //Default words (64 cells each) across a tile
+
+//TemporalEngine Class Declaration
+class TemporalEngine : public Engine
+{
+	private:
+		int depth;		//Generations advanced per pass over the board
+		int tileRows;	//Rows in a tile, not counting the halo
+		int tileWords;	//Words across a tile, not counting the halo
+		Grid next;		//Board the tiles are written back to
+		std::vector<uint64_t> bufferA; //Tile and halo, even steps
+		std::vector<uint64_t> bufferB; //Tile and halo, odd steps
+		std::vector<uint64_t> zeros;   //Dead row used outside the board
+
+		void advanceTile( Grid &, Grid &, int, int, int );
+		void pass( Grid &, int );
+
+	public:
+		/********************************************************************************
+		*	Function: TemporalEngine( int, int, int )
+		*	Description: Constructor of a temporally blocked engine. Values less than 1
+		*		are raised to 1.
+		*	Parameters: The generations per pass (k), the rows in a tile and the words
+		*		across a tile
+		*	Pre-Conditions: None
+		*	Post-Conditions: The engine is ready to advance grids
+		* ******************************************************************************/
+		TemporalEngine( int = TEMPORAL_DEPTH, int = TEMPORAL_TILE_ROWS,
+				int = TEMPORAL_TILE_WORDS );
+
+		/********************************************************************************
+		*	Function: advance( Grid &, int )
+		*	Description: Advances every cell of a grid by a number of generations,
+		*		depth generations per pass over the board. A last partial pass covers
+		*		any remainder.
+		*	Parameters: The grid to update and the number of generations
+		*	Pre-Conditions: generations should not be negative
+		*	Post-Conditions: The grid holds the board that many generations later and
+		*		every tile that changed is marked
+		* ******************************************************************************/
+		void advance( Grid &, int );
+
+		const char *getName() const
+		{ return "temporal"; }
+
+		int getDepth() const
+		{ return depth; }
+
+		void setDepth( int k )
+		{ depth = k < 1 ? 1 : k; }
+};
+
+#endif
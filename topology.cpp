@@ -0,0 +1,255 @@
+/******************************************************************************
+ ** Program Filename: topology.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the Topology class function implementation file
+ ** Input: The node and cpu lists under /sys/devices/system/node
+ ** Output: None
+ * ***************************************************************************/
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <stdint.h>
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "topology.hpp"
+
+#define TOPOLOGY_NODE_PATH "/sys/devices/system/node/node"
+#define TOPOLOGY_MAX_NODES 1024	//Nodes to look for in /sys
+#define TOPOLOGY_QUERY_PAGES 1024	//Pages asked about in one move_pages call
+
+/********************************************************************************
+*	Function: parseList( const std::string & )
+*	Description: Reads a kernel cpu list such as "0-3,8,10-11"
+*	Parameters: The list
+*	Pre-Conditions: None
+*	Post-Conditions: returns the numbers in the list
+* ******************************************************************************/
+std::vector<int> Topology::parseList( const std::string &text )
+{
+	std::vector<int> list;
+	std::istringstream in( text );
+	std::string range;
+
+	while( std::getline( in, range, ',' ) )
+	{
+		size_t dash = range.find( '-' );
+		int first = atoi( range.c_str() );
+		int last = dash == std::string::npos ? first : atoi( range.c_str() + dash + 1 );
+
+		if( range.find_first_of( "0123456789" ) == std::string::npos )
+			continue;
+		for( int cpu = first; cpu <= last; cpu++ )
+			list.push_back( cpu );
+	}
+	return list;
+}
+
+/********************************************************************************
+*	Function: Topology()
+*	Description: Constructor, reads the nodes and their cores. Cores this process
+*		is not allowed to run on, and nodes left with no cores, are dropped.
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: There is at least one node with at least one core
+* ******************************************************************************/
+Topology::Topology()
+{
+	cpu_set_t allowed;
+	bool known = sched_getaffinity( 0, sizeof(allowed), &allowed ) == 0;
+
+	for( int node = 0; node < TOPOLOGY_MAX_NODES; node++ )
+	{
+		std::ostringstream path;
+		path << TOPOLOGY_NODE_PATH << node << "/cpulist";
+		std::ifstream file( path.str().c_str() );
+		std::string text;
+
+		if( !file || !std::getline( file, text ) )
+			continue;
+
+		std::vector<int> list = parseList( text );
+		std::vector<int> usable;
+		for( size_t i = 0; i < list.size(); i++ )
+			if( !known || (list[i] < CPU_SETSIZE && CPU_ISSET( list[i], &allowed )) )
+				usable.push_back( list[i] );
+		if( usable.empty() )
+			continue;
+
+		nodeIds.push_back( node );
+		cpus.push_back( usable );
+	}
+
+	//No node information, so every core is on one node
+	if( nodeIds.empty() )
+	{
+		std::vector<int> usable;
+		for( int cpu = 0; known && cpu < CPU_SETSIZE; cpu++ )
+			if( CPU_ISSET( cpu, &allowed ) )
+				usable.push_back( cpu );
+		if( usable.empty() )
+			usable.push_back( 0 );
+
+		nodeIds.push_back( 0 );
+		cpus.push_back( usable );
+	}
+}
+
+/********************************************************************************
+*	Function: order( int )
+*	Description: Lists the cores in the order workers should be pinned to them
+*	Parameters: The affinity policy, AFFINITY_COMPACT or AFFINITY_SCATTER.
+*		AFFINITY_NONE gives the compact order.
+*	Pre-Conditions: None
+*	Post-Conditions: returns every core once
+* ******************************************************************************/
+std::vector<int> Topology::order( int policy ) const
+{
+	std::vector<int> list;
+
+	if( policy != AFFINITY_SCATTER )
+	{
+		for( size_t n = 0; n < cpus.size(); n++ )
+			list.insert( list.end(), cpus[n].begin(), cpus[n].end() );
+		return list;
+	}
+
+	for( size_t i = 0; (int)list.size() < getCpuCount(); i++ )
+		for( size_t n = 0; n < cpus.size(); n++ )
+			if( i < cpus[n].size() )
+				list.push_back( cpus[n][i] );
+	return list;
+}
+
+/********************************************************************************
+*	Function: nodeOfCpu( int )
+*	Description: Finds the node a core is on
+*	Parameters: The core
+*	Pre-Conditions: None
+*	Post-Conditions: returns the index of the node, 0 for an unknown core
+* ******************************************************************************/
+int Topology::nodeOfCpu( int cpu ) const
+{
+	for( size_t n = 0; n < cpus.size(); n++ )
+		for( size_t i = 0; i < cpus[n].size(); i++ )
+			if( cpus[n][i] == cpu )
+				return (int)n;
+	return 0;
+}
+
+/********************************************************************************
+*	Function: nodeOfPages( const void *, size_t, std::vector<int> & )
+*	Description: Asks the kernel which node holds each page of a block of memory.
+*		move_pages with no target nodes only reports, it moves nothing.
+*	Parameters: The start of the block, its size in bytes, and the vector to
+*		fill with the index of the node of each page
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the kernel cannot tell, and pages not yet
+*		touched or on unknown nodes are -1
+* ******************************************************************************/
+bool Topology::nodeOfPages( const void *start, size_t bytes, std::vector<int> &nodes ) const
+{
+	size_t page = (size_t)sysconf( _SC_PAGESIZE );
+	uintptr_t first = (uintptr_t)start / page * page;
+	size_t count = bytes == 0 ? 0 : ((uintptr_t)start + bytes - first + page - 1) / page;
+	std::vector<void *> pages( TOPOLOGY_QUERY_PAGES );
+	std::vector<int> status( TOPOLOGY_QUERY_PAGES );
+
+	nodes.assign( count, -1 );
+	for( size_t done = 0; done < count; done += TOPOLOGY_QUERY_PAGES )
+	{
+		size_t batch = std::min( count - done, (size_t)TOPOLOGY_QUERY_PAGES );
+		for( size_t i = 0; i < batch; i++ )
+			pages[i] = (void *)(first + (done + i) * page);
+
+		if( syscall( SYS_move_pages, 0, (unsigned long)batch, &pages[0], NULL,
+				&status[0], 0 ) != 0 )
+			return false;
+
+		for( size_t i = 0; i < batch; i++ )
+			for( size_t n = 0; status[i] >= 0 && n < nodeIds.size(); n++ )
+				if( nodeIds[n] == status[i] )
+					nodes[done + i] = (int)n;
+	}
+	return true;
+}
+
+/********************************************************************************
+*	Function: pin( int )
+*	Description: Pins the calling thread to one core
+*	Parameters: The core
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the thread could not be pinned
+* ******************************************************************************/
+bool Topology::pin( int cpu )
+{
+	cpu_set_t set;
+
+	if( cpu < 0 || cpu >= CPU_SETSIZE )
+		return false;
+	CPU_ZERO( &set );
+	CPU_SET( cpu, &set );
+	return pthread_setaffinity_np( pthread_self(), sizeof(set), &set ) == 0;
+}
+
+/********************************************************************************
+*	Function: currentCpu()
+*	Description: Returns the core the calling thread is running on
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns the core, or -1 if it cannot be found
+* ******************************************************************************/
+int Topology::currentCpu()
+{
+	return sched_getcpu();
+}
+
+/********************************************************************************
+*	Function: parsePolicy( const std::string & )
+*	Description: Reads an affinity policy name: "none", "compact" or "scatter"
+*	Parameters: The name
+*	Pre-Conditions: None
+*	Post-Conditions: returns the policy, or -1 for an unknown name
+* ******************************************************************************/
+int Topology::parsePolicy( const std::string &name )
+{
+	for( int policy = AFFINITY_NONE; policy <= AFFINITY_SCATTER; policy++ )
+		if( name == policyName( policy ) )
+			return policy;
+	return -1;
+}
+
+/********************************************************************************
+*	Function: policyName( int )
+*	Description: Returns the name of an affinity policy
+*	Parameters: The policy
+*	Pre-Conditions: None
+*	Post-Conditions: returns "none", "compact" or "scatter"
+* ******************************************************************************/
+const char *Topology::policyName( int policy )
+{
+	if( policy == AFFINITY_COMPACT )
+		return "compact";
+	if( policy == AFFINITY_SCATTER )
+		return "scatter";
+	return "none";
+}
+
+/********************************************************************************
+*	Function: getCpuCount()
+*	Description: Counts the cores on every node
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns the number of cores this process may use
+* ******************************************************************************/
+int Topology::getCpuCount() const
+{
+	int count = 0;
+
+	for( size_t n = 0; n < cpus.size(); n++ )
+		count += (int)cpus[n].size();
+	return count;
+}
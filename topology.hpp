@@ -0,0 +1,130 @@
+/******************************************************************************
+ ** Program Filename: topology.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the Topology class. A Topology
+			finds the NUMA nodes of the machine and the cores on each one that
+			this process may run on, read from /sys/devices/system/node. On a
+			machine or container without that information every core is put
+			on a single node 0, so callers never need a second code path. It
+			can order the cores for an affinity policy, pin the calling thread
+			to a core, and ask the kernel which node holds each page of a
+			block of memory.
+ ** Input: The node and cpu lists under /sys/devices/system/node
+ ** Output: None
+ * ***************************************************************************/
+#ifndef TOPOLOGY_HPP
+#define TOPOLOGY_HPP
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define AFFINITY_NONE 0		//Workers are not pinned, the scheduler places them
+#define AFFINITY_COMPACT 1	//Workers fill every core of a node before the next node
+#define AFFINITY_SCATTER 2	//Workers go round the nodes, one core from each in turn
+
+//Topology Class Declaration
+class Topology
+{
+	private:
+		std::vector<int> nodeIds;			 //Kernel number of each node
+		std::vector<std::vector<int> > cpus; //Cores of each node this process may use
+
+		static std::vector<int> parseList( const std::string & );
+
+	public:
+		/********************************************************************************
+		*	Function: Topology()
+		*	Description: Constructor, reads the nodes and their cores
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: There is at least one node with at least one core
+		* ******************************************************************************/
+		Topology();
+
+		/********************************************************************************
+		*	Function: order( int )
+		*	Description: Lists the cores in the order workers should be pinned to them
+		*	Parameters: The affinity policy, AFFINITY_COMPACT or AFFINITY_SCATTER.
+		*		AFFINITY_NONE gives the compact order.
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns every core once
+		* ******************************************************************************/
+		std::vector<int> order( int ) const;
+
+		/********************************************************************************
+		*	Function: nodeOfCpu( int )
+		*	Description: Finds the node a core is on
+		*	Parameters: The core
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the index of the node, 0 for an unknown core
+		* ******************************************************************************/
+		int nodeOfCpu( int ) const;
+
+		/********************************************************************************
+		*	Function: nodeOfPages( const void *, size_t, std::vector<int> & )
+		*	Description: Asks the kernel which node holds each page of a block of memory
+		*	Parameters: The start of the block, its size in bytes, and the vector to
+		*		fill with the index of the node of each page
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false if the kernel cannot tell, and pages not yet
+		*		touched or on unknown nodes are -1
+		* ******************************************************************************/
+		bool nodeOfPages( const void *, size_t, std::vector<int> & ) const;
+
+		/********************************************************************************
+		*	Function: pin( int )
+		*	Description: Pins the calling thread to one core
+		*	Parameters: The core
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false if the thread could not be pinned
+		* ******************************************************************************/
+		static bool pin( int );
+
+		/********************************************************************************
+		*	Function: currentCpu()
+		*	Description: Returns the core the calling thread is running on
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the core, or -1 if it cannot be found
+		* ******************************************************************************/
+		static int currentCpu();
+
+		/********************************************************************************
+		*	Function: parsePolicy( const std::string & )
+		*	Description: Reads an affinity policy name: "none", "compact" or "scatter"
+		*	Parameters: The name
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the policy, or -1 for an unknown name
+		* ******************************************************************************/
+		static int parsePolicy( const std::string & );
+
+		/********************************************************************************
+		*	Function: policyName( int )
+		*	Description: Returns the name of an affinity policy
+		*	Parameters: The policy
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns "none", "compact" or "scatter"
+		* ******************************************************************************/
+		static const char *policyName( int );
+
+		int getNodes() const
+		{ return (int)nodeIds.size(); }
+
+		int getNodeId( int n ) const
+		{ return nodeIds[n]; }
+
+		const std::vector<int> &getCpus( int n ) const
+		{ return cpus[n]; }
+
+		/********************************************************************************
+		*	Function: getCpuCount()
+		*	Description: Counts the cores on every node
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the number of cores this process may use
+		* ******************************************************************************/
+		int getCpuCount() const;
+};
+
+#endif
@@ -0,0 +1,357 @@
+/******************************************************************************
+ ** Program Filename: viewport.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the Viewport class function implementation file
+ ** Input: None
+ ** Output: The window of the board to an output stream
+ * ***************************************************************************/
+#include <algorithm>
+#include <cstring>
+#include "viewport.hpp"
+
+#define VIEW_TILE_LEVEL 6	 //Level whose blocks are the tiles of the change map
+
+/********************************************************************************
+*	Function: floorDiv( long long, long long )
+*	Description: Divides rounding toward minus infinity, so windows panned past
+*		the top or left edge still line up with the blocks
+*	Parameters: The dividend and a positive divisor
+*	Pre-Conditions: The divisor is positive
+*	Post-Conditions: returns the quotient
+* ******************************************************************************/
+static long long floorDiv( long long a, long long b )
+{
+	return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+/********************************************************************************
+*	Function: Viewport( int, int )
+*	Description: Constructor of a window at zoom 0 on the top left of the board
+*	Parameters: The rows and columns of characters in the window
+*	Pre-Conditions: None
+*	Post-Conditions: The pyramid is empty until update() is called
+* ******************************************************************************/
+Viewport::Viewport( int rows, int cols )
+{
+	boardRows = 0;
+	boardCols = 0;
+	zoom = 0;
+	top = 0;
+	left = 0;
+	setSize( rows, cols );
+}
+
+/********************************************************************************
+*	Function: countBase( const Grid &, int, int )
+*	Description: Counts the live cells of a block at the base level from the board
+*	Parameters: The board, and the row and column of the block
+*	Pre-Conditions: The block is on the board
+*	Post-Conditions: returns the count
+* ******************************************************************************/
+long long Viewport::countBase( const Grid &grid, int br, int bc ) const
+{
+	int size = 1 << VIEW_BASE_LEVEL;
+	int w = bc * size / WORD_BITS;
+	int shift = bc * size % WORD_BITS;
+	uint64_t mask = ((uint64_t)1 << size) - 1;
+	int r1 = std::min( grid.getRows(), (br + 1) * size );
+	long long count = 0;
+
+	for( int r = br * size; r < r1; r++ )
+		count += __builtin_popcountll( (grid.row( r )[w] >> shift) & mask );
+	return count;
+}
+
+/********************************************************************************
+*	Function: recount( int, int, int )
+*	Description: Sums the four blocks below a block of the pyramid
+*	Parameters: The index of the level above the base, and the row and column
+*		of the block
+*	Pre-Conditions: The level below is up to date
+*	Post-Conditions: The block's count is updated
+* ******************************************************************************/
+void Viewport::recount( int i, int r, int c )
+{
+	const std::vector<long long> &below = counts[i-1];
+	int rows = levelRows[i-1];
+	int cols = levelCols[i-1];
+	long long sum = 0;
+
+	for( int y = 2 * r; y < std::min( rows, 2 * r + 2 ); y++ )
+		for( int x = 2 * c; x < std::min( cols, 2 * c + 2 ); x++ )
+			sum += below[(size_t)y * cols + x];
+	counts[i][(size_t)r * levelCols[i] + c] = sum;
+}
+
+/********************************************************************************
+*	Function: build( const Grid & )
+*	Description: Sizes the pyramid for a board and counts every block
+*	Parameters: The board
+*	Pre-Conditions: None
+*	Post-Conditions: Every level is up to date, the top one a single block
+* ******************************************************************************/
+void Viewport::build( const Grid &grid )
+{
+	boardRows = grid.getRows();
+	boardCols = grid.getCols();
+	counts.clear();
+	levelRows.clear();
+	levelCols.clear();
+
+	for( int level = VIEW_BASE_LEVEL; ; level++ )
+	{
+		long long size = (long long)1 << level;
+		int rows = (int)((boardRows + size - 1) / size);
+		int cols = (int)((boardCols + size - 1) / size);
+
+		levelRows.push_back( rows );
+		levelCols.push_back( cols );
+		counts.push_back( std::vector<long long>( (size_t)rows * cols, 0 ) );
+		if( rows <= 1 && cols <= 1 )
+			break;
+	}
+
+	for( int r = 0; r < levelRows[0]; r++ )
+		for( int c = 0; c < levelCols[0]; c++ )
+			counts[0][(size_t)r * levelCols[0] + c] = countBase( grid, r, c );
+
+	for( size_t i = 1; i < counts.size(); i++ )
+		for( int r = 0; r < levelRows[i]; r++ )
+			for( int c = 0; c < levelCols[i]; c++ )
+				recount( (int)i, r, c );
+}
+
+/********************************************************************************
+*	Function: update( Grid & )
+*	Description: Brings the pyramid up to date with a board. Only the tiles
+*		marked changed are recounted, unless the board changed size, and the
+*		marks are then cleared.
+*	Parameters: The board
+*	Pre-Conditions: Every change since the last update is marked on the board
+*	Post-Conditions: returns the number of tiles recounted
+* ******************************************************************************/
+long long Viewport::update( Grid &grid )
+{
+	int tileRows = grid.getTileRows();
+	int words = grid.getRowWords();
+	int tileIndex = VIEW_TILE_LEVEL - VIEW_BASE_LEVEL;
+	int levels = (int)counts.size();
+	long long recounted = 0;
+
+	if( counts.empty() || grid.getRows() != boardRows || grid.getCols() != boardCols )
+	{
+		build( grid );
+		grid.clearChanged();
+		return (long long)tileRows * words;
+	}
+
+	dirty.clear();
+	for( int tr = 0; tr < tileRows; tr++ )
+		for( int w = 0; w < words; w++ )
+		{
+			if( !grid.isChanged( tr, w ) )
+				continue;
+			recounted++;
+
+			//Recount the blocks inside the tile, from the base up to the tile itself
+			for( int i = 0; i <= tileIndex && i < levels; i++ )
+			{
+				int shift = VIEW_BASE_LEVEL + i;
+				int r0 = (tr * TILE_ROWS) >> shift;
+				int r1 = std::min( levelRows[i], (((tr + 1) * TILE_ROWS - 1) >> shift) + 1 );
+				int c0 = (w * WORD_BITS) >> shift;
+				int c1 = std::min( levelCols[i], (((w + 1) * WORD_BITS - 1) >> shift) + 1 );
+
+				for( int r = r0; r < r1; r++ )
+					for( int c = c0; c < c1; c++ )
+					{
+						if( i == 0 )
+							counts[0][(size_t)r * levelCols[0] + c] = countBase( grid, r, c );
+						else
+							recount( i, r, c );
+					}
+			}
+			if( tileIndex < levels )
+				dirty.push_back( (long long)tr * levelCols[tileIndex] + w );
+		}
+
+	//Above the tiles each changed block changes its parent, so the dirty
+	//	blocks halve in each direction at every level
+	for( int i = tileIndex + 1; i < levels; i++ )
+	{
+		for( size_t d = 0; d < dirty.size(); d++ )
+		{
+			long long r = dirty[d] / levelCols[i-1];
+			long long c = dirty[d] % levelCols[i-1];
+			dirty[d] = (r / 2) * levelCols[i] + c / 2;
+		}
+		std::sort( dirty.begin(), dirty.end() );
+		dirty.erase( std::unique( dirty.begin(), dirty.end() ), dirty.end() );
+
+		for( size_t d = 0; d < dirty.size(); d++ )
+			recount( i, (int)(dirty[d] / levelCols[i]), (int)(dirty[d] % levelCols[i]) );
+	}
+
+	grid.clearChanged();
+	return recounted;
+}
+
+/********************************************************************************
+*	Function: getCount( int, long long, long long )
+*	Description: Returns the live cells of a block of the pyramid. Levels above
+*		the top hold the whole board in their first block.
+*	Parameters: The level, and the row and column of the block at that level
+*	Pre-Conditions: update() was called since the board last changed, and the
+*		level is at least VIEW_BASE_LEVEL
+*	Post-Conditions: returns the count, 0 for blocks off the board
+* ******************************************************************************/
+long long Viewport::getCount( int level, long long r, long long c ) const
+{
+	int i = level - VIEW_BASE_LEVEL;
+
+	if( i < 0 || counts.empty() || r < 0 || c < 0 )
+		return 0;
+	if( i >= (int)counts.size() )
+		return r == 0 && c == 0 ? counts.back()[0] : 0;
+	if( r >= levelRows[i] || c >= levelCols[i] )
+		return 0;
+	return counts[i][(size_t)r * levelCols[i] + c];
+}
+
+/********************************************************************************
+*	Function: countBits( const Grid &, long long, long long )
+*	Description: Counts the live cells of a block below the base level straight
+*		from the board. The block never crosses a word.
+*	Parameters: The board, and the row and column of the block at the current zoom
+*	Pre-Conditions: The zoom is less than VIEW_BASE_LEVEL and the block is on the
+*		board
+*	Post-Conditions: returns the count
+* ******************************************************************************/
+long long Viewport::countBits( const Grid &grid, long long br, long long bc ) const
+{
+	int size = 1 << zoom;
+	int w = (int)(bc * size / WORD_BITS);
+	int shift = (int)(bc * size % WORD_BITS);
+	uint64_t mask = ((uint64_t)1 << size) - 1;
+	int r1 = (int)std::min( (long long)grid.getRows(), (br + 1) * size );
+	long long count = 0;
+
+	for( int r = (int)(br * size); r < r1; r++ )
+		count += __builtin_popcountll( (grid.row( r )[w] >> shift) & mask );
+	return count;
+}
+
+/********************************************************************************
+*	Function: render( const Grid &, std::ostream & )
+*	Description: Draws the window. At zoom 0 live cells are '0' and dead cells
+*		'.', as outputWorld draws them. Zoomed out, each character is the
+*		glyph for the density of its block. Characters off the board are blank.
+*	Parameters: The board and the stream to draw to
+*	Pre-Conditions: update() was called since the board last changed
+*	Post-Conditions: height lines of width characters are written
+* ******************************************************************************/
+void Viewport::render( const Grid &grid, std::ostream &out ) const
+{
+	const char *glyphs = VIEW_GLYPHS;
+	long long shades = (long long)strlen( glyphs ) - 1;
+	long long size = (long long)1 << zoom;
+	long long br0 = floorDiv( top, size );
+	long long bc0 = floorDiv( left, size );
+	long long rows = grid.getRows();
+	long long cols = grid.getCols();
+	std::string line( width, ' ' );
+
+	for( int i = 0; i < height; i++ )
+	{
+		long long br = br0 + i;
+
+		for( int j = 0; j < width; j++ )
+		{
+			long long bc = bc0 + j;
+
+			if( br < 0 || bc < 0 || br * size >= rows || bc * size >= cols )
+			{
+				line[j] = ' ';
+				continue;
+			}
+			if( zoom == 0 )
+			{
+				line[j] = grid.getCell( (int)br, (int)bc ) ? '0' : '.';
+				continue;
+			}
+
+			long long count = zoom < VIEW_BASE_LEVEL ? countBits( grid, br, bc )
+					: getCount( zoom, br, bc );
+			long long area = (std::min( rows, (br + 1) * size ) - br * size)
+					* (std::min( cols, (bc + 1) * size ) - bc * size);
+
+			//Any live cell shows, and only a full block gets the last glyph
+			if( count == 0 )
+				line[j] = glyphs[0];
+			else
+				line[j] = glyphs[1 + (count * (shades - 1)) / area];
+		}
+		out << line << '\n';
+	}
+	out.flush();
+}
+
+/********************************************************************************
+*	Function: setZoom( int )
+*	Description: Zooms in or out keeping the center of the window in place.
+*		Zoom is clamped to 0 through VIEW_MAX_ZOOM.
+*	Parameters: The zoom, each character covering 2^zoom X 2^zoom cells
+*	Pre-Conditions: None
+*	Post-Conditions: The zoom is set
+* ******************************************************************************/
+void Viewport::setZoom( int z )
+{
+	long long size = (long long)1 << zoom;
+	long long midRow = top + height * size / 2;
+	long long midCol = left + width * size / 2;
+
+	zoom = std::max( 0, std::min( VIEW_MAX_ZOOM, z ) );
+	center( midRow, midCol );
+}
+
+/********************************************************************************
+*	Function: pan( long long, long long )
+*	Description: Moves the window by a number of characters at the current zoom
+*	Parameters: The rows and columns to move, negative for up and left
+*	Pre-Conditions: None
+*	Post-Conditions: The window is moved
+* ******************************************************************************/
+void Viewport::pan( long long rows, long long cols )
+{
+	top += rows * ((long long)1 << zoom);
+	left += cols * ((long long)1 << zoom);
+}
+
+/********************************************************************************
+*	Function: center( long long, long long )
+*	Description: Moves the window so a cell is in its center
+*	Parameters: The row and column of the cell
+*	Pre-Conditions: None
+*	Post-Conditions: The window is moved
+* ******************************************************************************/
+void Viewport::center( long long r, long long c )
+{
+	long long size = (long long)1 << zoom;
+
+	top = r - height * size / 2;
+	left = c - width * size / 2;
+}
+
+/********************************************************************************
+*	Function: setSize( int, int )
+*	Description: Sets the rows and columns of characters in the window
+*	Parameters: The rows and the columns
+*	Pre-Conditions: None
+*	Post-Conditions: The size is set, at least 1 X 1
+* ******************************************************************************/
+void Viewport::setSize( int rows, int cols )
+{
+	height = rows < 1 ? 1 : rows;
+	width = cols < 1 ? 1 : cols;
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+ ** Program Filename: viewport.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the Viewport class. A Viewport
+			shows a window of a Grid of any size at any zoom, where zoom z
+			draws one character for each 2^z X 2^z block of cells. It keeps a
+			mipmap pyramid of population counts: level L counts the live cells
+			of every 2^L X 2^L block, from VIEW_BASE_LEVEL up to one block
+			holding the whole board. update() recounts only the tiles the
+			Grid has marked changed and the blocks above them, and render()
+			reads one count per character, so drawing costs time in
+			proportion to the screen, not the board. Zoomed out blocks are
+			drawn with a glyph for their density of live cells.
+ ** Input: None
+ ** Output: The window of the board to an output stream
+ * ***************************************************************************/
+#ifndef VIEWPORT_HPP
+#define VIEWPORT_HPP
+#include <ostream>
+#include <string>
+#include <vector>
+#include "grid.hpp"
+
+#define VIEW_BASE_LEVEL 4	//Lowest level of the pyramid, 16 X 16 blocks
+#define VIEW_HEIGHT 22		//Default rows of characters, as outputWorld shows
+#define VIEW_WIDTH 80		//Default columns of characters, as outputWorld shows
+#define VIEW_GLYPHS ".:-=+*#%@"	//Empty block, then density from lowest to full
+#define VIEW_MAX_ZOOM 40	//Zoom past any board an int can size
+
+//Viewport Class Declaration
+class Viewport
+{
+	private:
+		int boardRows;		//Rows of the board the pyramid was built for
+		int boardCols;		//Columns of the board the pyramid was built for
+		std::vector<std::vector<long long> > counts; //Counts of each level, row by row
+		std::vector<int> levelRows;	//Rows of blocks at each level
+		std::vector<int> levelCols;	//Columns of blocks at each level
+		std::vector<long long> dirty;	//Blocks to recount at the current level
+		int zoom;			//Cells across a character are 2^zoom
+		long long top;		//Board row at the top edge of the window
+		long long left;		//Board column at the left edge of the window
+		int height;			//Rows of characters in the window
+		int width;			//Columns of characters in the window
+
+		void build( const Grid & );
+		long long countBase( const Grid &, int, int ) const;
+		void recount( int, int, int );
+		long long countBits( const Grid &, long long, long long ) const;
+
+	public:
+		/********************************************************************************
+		*	Function: Viewport( int, int )
+		*	Description: Constructor of a window at zoom 0 on the top left of the board
+		*	Parameters: The rows and columns of characters in the window
+		*	Pre-Conditions: None
+		*	Post-Conditions: The pyramid is empty until update() is called
+		* ******************************************************************************/
+		Viewport( int = VIEW_HEIGHT, int = VIEW_WIDTH );
+
+		/********************************************************************************
+		*	Function: update( Grid & )
+		*	Description: Brings the pyramid up to date with a board. Only the tiles
+		*		marked changed are recounted, unless the board changed size, and the
+		*		marks are then cleared.
+		*	Parameters: The board
+		*	Pre-Conditions: Every change since the last update is marked on the board
+		*	Post-Conditions: returns the number of tiles recounted
+		* ******************************************************************************/
+		long long update( Grid & );
+
+		/********************************************************************************
+		*	Function: render( const Grid &, std::ostream & )
+		*	Description: Draws the window. At zoom 0 live cells are '0' and dead cells
+		*		'.', as outputWorld draws them. Zoomed out, each character is the
+		*		glyph for the density of its block. Characters off the board are blank.
+		*	Parameters: The board and the stream to draw to
+		*	Pre-Conditions: update() was called since the board last changed
+		*	Post-Conditions: height lines of width characters are written
+		* ******************************************************************************/
+		void render( const Grid &, std::ostream & ) const;
+
+		/********************************************************************************
+		*	Function: getCount( int, long long, long long )
+		*	Description: Returns the live cells of a block of the pyramid. Levels above
+		*		the top hold the whole board in their first block.
+		*	Parameters: The level, and the row and column of the block at that level
+		*	Pre-Conditions: update() was called since the board last changed, and the
+		*		level is at least VIEW_BASE_LEVEL
+		*	Post-Conditions: returns the count, 0 for blocks off the board
+		* ******************************************************************************/
+		long long getCount( int, long long, long long ) const;
+
+		/********************************************************************************
+		*	Function: setZoom( int )
+		*	Description: Zooms in or out keeping the center of the window in place.
+		*		Zoom is clamped to 0 through VIEW_MAX_ZOOM.
+		*	Parameters: The zoom, each character covering 2^zoom X 2^zoom cells
+		*	Pre-Conditions: None
+		*	Post-Conditions: The zoom is set
+		* ******************************************************************************/
+		void setZoom( int );
+
+		/********************************************************************************
+		*	Function: pan( long long, long long )
+		*	Description: Moves the window by a number of characters at the current zoom
+		*	Parameters: The rows and columns to move, negative for up and left
+		*	Pre-Conditions: None
+		*	Post-Conditions: The window is moved
+		* ******************************************************************************/
+		void pan( long long, long long );
+
+		/********************************************************************************
+		*	Function: center( long long, long long )
+		*	Description: Moves the window so a cell is in its center
+		*	Parameters: The row and column of the cell
+		*	Pre-Conditions: None
+		*	Post-Conditions: The window is moved
+		* ******************************************************************************/
+		void center( long long, long long );
+
+		/********************************************************************************
+		*	Function: setSize( int, int )
+		*	Description: Sets the rows and columns of characters in the window
+		*	Parameters: The rows and the columns
+		*	Pre-Conditions: None
+		*	Post-Conditions: The size is set, at least 1 X 1
+		* ******************************************************************************/
+		void setSize( int, int );
+
+		int getZoom() const
+		{ return zoom; }
+
+		long long getTop() const
+		{ return top; }
+
+		long long getLeft() const
+		{ return left; }
+
+		int getHeight() const
+		{ return height; }
+
+		int getWidth() const
+		{ return width; }
+
+		int getTopLevel() const
+		{ return VIEW_BASE_LEVEL + (int)counts.size() - 1; }
+};
+
+#endif
@@ -0,0 +1,570 @@
+/******************************************************************************
+ ** Program Filename: writer.cpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the FrameWriter class function implementation file
+ ** Input: Snapshots of a Grid
+ ** Output: RLE, binary frame, or PGM files
+ * ***************************************************************************/
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include "writer.hpp"
+
+#define FRAME_MAGIC "GOLF"	//First bytes of every binary frame
+
+/********************************************************************************
+*	Function: FrameWriter( const std::string &, int, int, size_t )
+*	Description: Constructor of a writer. The background thread is started when
+*		there are slots.
+*	Parameters: The file name prefix, the format, the number of slots (0 to
+*		write inline), and the bytes gathered before each pwrite
+*	Pre-Conditions: None
+*	Post-Conditions: The writer is ready for snapshots. A FRAME_BINARY file is
+*		created empty.
+* ******************************************************************************/
+FrameWriter::FrameWriter( const std::string &path, int kind, int count, size_t batchSize )
+{
+	prefix = path;
+	format = kind;
+	rule = "B3/S23";
+	head = 0;
+	tail = 0;
+	drained = true;
+	stopping = false;
+	failed = false;
+	fd = -1;
+	offset = 0;
+	batchBytes = batchSize < 1 ? 1 : batchSize;
+	lineLength = 0;
+	frames = 0;
+	bytes = 0;
+	stalls = 0;
+	stallSeconds = 0;
+	writeSeconds = 0;
+	maxQueued = 0;
+
+	//Byte b of cells becomes 8 pixels, bit j of b the j-th, 255 for alive
+	expand.assign( 256, 0 );
+	for( int b = 0; b < 256; b++ )
+	{
+		unsigned char eight[8];
+		for( int j = 0; j < 8; j++ )
+			eight[j] = (b >> j) & 1 ? 255 : 0;
+		memcpy( &expand[b], eight, 8 );
+	}
+
+	if( format == FRAME_BINARY && !openFile( framePath( prefix, format, 0 ), true ) )
+		failed = true;
+
+	if( count > 0 )
+	{
+		slots.resize( count );
+		slotGeneration.assign( count, 0 );
+		writer = std::thread( &FrameWriter::work, this );
+	}
+}
+
+/********************************************************************************
+*	Function: ~FrameWriter()
+*	Description: Destructor, writes every snapshot still waiting and stops the
+*		writer
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: Every submitted frame is on disk and the file is closed
+* ******************************************************************************/
+FrameWriter::~FrameWriter()
+{
+	if( writer.joinable() )
+	{
+		{
+			std::lock_guard<std::mutex> hold( lock );
+			stopping = true;
+		}
+		ready.notify_one();
+		writer.join();
+	}
+	flushBatch();
+	closeFile();
+}
+
+/********************************************************************************
+*	Function: work()
+*	Description: The writer's loop: write the oldest snapshot and free its slot,
+*		and when nothing is waiting push out the batch so a quiet stepper's
+*		frames still reach the disk
+*	Parameters: None
+*	Pre-Conditions: Started by the constructor
+*	Post-Conditions: Returns when stopping and every snapshot is written
+* ******************************************************************************/
+void FrameWriter::work()
+{
+	std::unique_lock<std::mutex> hold( lock );
+
+	for( ;; )
+	{
+		while( head == tail && !stopping )
+		{
+			if( !batch.empty() )
+			{
+				hold.unlock();
+				flushBatch();
+				hold.lock();
+				continue;
+			}
+			drained = true;
+			space.notify_all();
+			ready.wait( hold );
+		}
+		if( head == tail )
+			break;
+
+		size_t s = (size_t)(tail % (long long)slots.size());
+		long long generation = slotGeneration[s];
+		hold.unlock();
+
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		writeFrame( slots[s], generation );
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+		hold.lock();
+		writeSeconds += std::chrono::duration<double>( end - begin ).count();
+		tail++;
+		space.notify_all();
+	}
+	hold.unlock();
+	flushBatch();
+}
+
+/********************************************************************************
+*	Function: submit( const Grid &, long long )
+*	Description: Hands a snapshot of a board to the writer. The board is copied,
+*		so the caller may step it as soon as this returns. Blocks while every
+*		slot is waiting to be written. Only one thread may submit.
+*	Parameters: The board and its generation
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the writer has failed, and the snapshot is
+*		then dropped
+* ******************************************************************************/
+bool FrameWriter::submit( const Grid &grid, long long generation )
+{
+	if( slots.empty() )
+	{
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		writeFrame( grid, generation );
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+		writeSeconds += std::chrono::duration<double>( end - begin ).count();
+		return good();
+	}
+
+	std::unique_lock<std::mutex> hold( lock );
+	long long size = (long long)slots.size();
+
+	//Backpressure: wait for the writer rather than queue without bound
+	if( head - tail == size && !failed )
+	{
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		stalls++;
+		while( head - tail == size && !failed )
+			space.wait( hold );
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+		stallSeconds += std::chrono::duration<double>( end - begin ).count();
+	}
+	if( failed )
+		return false;
+
+	//The writer never reads the slot at head, so it is copied unlocked
+	size_t s = (size_t)(head % size);
+	hold.unlock();
+	slots[s] = grid;
+	slotGeneration[s] = generation;
+	hold.lock();
+
+	head++;
+	drained = false;
+	if( head - tail > maxQueued )
+		maxQueued = head - tail;
+	ready.notify_one();
+	return true;
+}
+
+/********************************************************************************
+*	Function: flush()
+*	Description: Waits until every submitted snapshot is written to disk
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the writer has failed
+* ******************************************************************************/
+bool FrameWriter::flush()
+{
+	if( slots.empty() )
+	{
+		flushBatch();
+		return good();
+	}
+
+	std::unique_lock<std::mutex> hold( lock );
+	while( !(head == tail && drained) && !failed )
+		space.wait( hold );
+	return !failed;
+}
+
+/********************************************************************************
+*	Function: writeFrame( const Grid &, long long )
+*	Description: Encodes one frame in the writer's format. RLE and PGM frames
+*		get their own file.
+*	Parameters: The board and its generation
+*	Pre-Conditions: None
+*	Post-Conditions: The frame is in the batch or on disk
+* ******************************************************************************/
+void FrameWriter::writeFrame( const Grid &grid, long long generation )
+{
+	if( format == FRAME_BINARY )
+		encodeBinary( grid, generation );
+	else
+	{
+		if( !openFile( framePath( prefix, format, generation ), true ) )
+		{
+			std::lock_guard<std::mutex> hold( lock );
+			failed = true;
+			return;
+		}
+		if( format == FRAME_PGM )
+			encodePgm( grid );
+		else
+			encodeRle( grid, generation );
+		flushBatch();
+		closeFile();
+	}
+
+	std::lock_guard<std::mutex> hold( lock );
+	frames++;
+}
+
+/********************************************************************************
+*	Function: encodeBinary( const Grid &, long long )
+*	Description: Appends a header and the packed rows of a board
+*	Parameters: The board and its generation
+*	Pre-Conditions: The frames file is open
+*	Post-Conditions: The frame is in the batch
+* ******************************************************************************/
+void FrameWriter::encodeBinary( const Grid &grid, long long generation )
+{
+	int64_t gen = generation;
+	int32_t size[2] = { grid.getRows(), grid.getCols() };
+
+	put( FRAME_MAGIC, 4 );
+	put( &gen, sizeof(gen) );
+	put( size, sizeof(size) );
+	put( grid.row( 0 ), grid.bytes() );
+}
+
+/********************************************************************************
+*	Function: encodePgm( const Grid & )
+*	Description: Writes a board as a binary greyscale image, one pixel per cell,
+*		255 for alive and 0 for dead
+*	Parameters: The board
+*	Pre-Conditions: The frame's file is open
+*	Post-Conditions: The image is in the batch
+* ******************************************************************************/
+void FrameWriter::encodePgm( const Grid &grid )
+{
+	char header[64];
+	int words = grid.getRowWords();
+	int length = snprintf( header, sizeof(header), "P5\n%d %d\n255\n", grid.getCols(),
+			grid.getRows() );
+
+	put( header, length );
+	pixels.resize( (size_t)words * WORD_BITS );
+	for( int r = 0; r < grid.getRows(); r++ )
+	{
+		const uint64_t *cells = grid.row( r );
+		for( int w = 0; w < words; w++ )
+			for( int b = 0; b < 8; b++ )
+				memcpy( &pixels[(size_t)w * WORD_BITS + b * 8],
+						&expand[(cells[w] >> (b * 8)) & 0xff], 8 );
+		put( &pixels[0], grid.getCols() );
+	}
+}
+
+/********************************************************************************
+*	Function: nextCell( const uint64_t *, int, int, bool )
+*	Description: Finds the first live (or dead) cell of a row at or after a column
+*	Parameters: The packed row, the number of columns, the column to start at,
+*		and true to look for a live cell
+*	Pre-Conditions: None
+*	Post-Conditions: returns the column, or the number of columns if there is none
+* ******************************************************************************/
+static int nextCell( const uint64_t *cells, int cols, int from, bool alive )
+{
+	int words = (cols + WORD_BITS - 1) / WORD_BITS;
+
+	for( int w = from / WORD_BITS; w < words; w++ )
+	{
+		uint64_t bits = alive ? cells[w] : ~cells[w];
+		if( w == from / WORD_BITS )
+			bits &= ~(uint64_t)0 << (from % WORD_BITS);
+		if( bits )
+		{
+			int c = w * WORD_BITS + __builtin_ctzll( bits );
+			return c < cols ? c : cols;
+		}
+	}
+	return cols;
+}
+
+/********************************************************************************
+*	Function: rleToken( long long, char )
+*	Description: Appends a run to an RLE pattern, starting a new line before
+*		FRAME_RLE_LINE characters would be passed
+*	Parameters: The length of the run and its tag: 'b' dead, 'o' alive, '$' end
+*		of row, '!' end of pattern
+*	Pre-Conditions: None
+*	Post-Conditions: The run is in the batch
+* ******************************************************************************/
+void FrameWriter::rleToken( long long count, char tag )
+{
+	char token[24];
+	int length = 0;
+
+	//Formatted by hand: random boards make a token every cell or two
+	if( count > 1 )
+	{
+		char digits[20];
+		int n = 0;
+		for( ; count > 0; count /= 10 )
+			digits[n++] = (char)('0' + count % 10);
+		while( n > 0 )
+			token[length++] = digits[--n];
+	}
+	token[length++] = tag;
+
+	if( lineLength + length > FRAME_RLE_LINE )
+	{
+		put( "\n", 1 );
+		lineLength = 0;
+	}
+	put( token, length );
+	lineLength += length;
+}
+
+/********************************************************************************
+*	Function: encodeRle( const Grid &, long long )
+*	Description: Writes a board as an RLE pattern. Dead cells at the end of a
+*		row are left out and empty rows are folded into the row ends.
+*	Parameters: The board and its generation
+*	Pre-Conditions: The frame's file is open
+*	Post-Conditions: The pattern is in the batch
+* ******************************************************************************/
+void FrameWriter::encodeRle( const Grid &grid, long long generation )
+{
+	char header[128];
+	int cols = grid.getCols();
+	long long rowEnds = 0;
+	int length = snprintf( header, sizeof(header),
+			"#C generation %lld\nx = %d, y = %d, rule = ", generation, cols, grid.getRows() );
+
+	put( header, length );
+	put( rule.c_str(), rule.size() );
+	put( "\n", 1 );
+	lineLength = 0;
+
+	for( int r = 0; r < grid.getRows(); r++ )
+	{
+		const uint64_t *cells = grid.row( r );
+		int c = 0;
+
+		for( ;; )
+		{
+			int born = nextCell( cells, cols, c, true );
+			if( born >= cols )
+				break;
+			if( rowEnds > 0 )
+			{
+				rleToken( rowEnds, '$' );
+				rowEnds = 0;
+			}
+
+			int dead = nextCell( cells, cols, born, false );
+			if( born > c )
+				rleToken( born - c, 'b' );
+			rleToken( dead - born, 'o' );
+			c = dead;
+		}
+		rowEnds++;
+	}
+	rleToken( 1, '!' );
+	put( "\n", 1 );
+}
+
+/********************************************************************************
+*	Function: put( const void *, size_t )
+*	Description: Adds bytes to the batch, writing the batch out each time it
+*		fills. Blocks larger than the batch are written straight through.
+*	Parameters: The bytes and how many
+*	Pre-Conditions: A file is open
+*	Post-Conditions: The bytes are in the batch or on disk
+* ******************************************************************************/
+void FrameWriter::put( const void *data, size_t size )
+{
+	const char *from = static_cast<const char *>( data );
+
+	if( batch.size() + size > batchBytes )
+		flushBatch();
+	if( size <= batchBytes )
+	{
+		batch.insert( batch.end(), from, from + size );
+		return;
+	}
+
+	batch.assign( from, from + size );
+	flushBatch();
+}
+
+/********************************************************************************
+*	Function: openFile( const std::string &, bool )
+*	Description: Opens the file the batch is written to
+*	Parameters: The file name and true to empty it
+*	Pre-Conditions: None
+*	Post-Conditions: returns false if the file cannot be opened
+* ******************************************************************************/
+bool FrameWriter::openFile( const std::string &path, bool truncate )
+{
+	closeFile();
+	fd = open( path.c_str(), O_WRONLY | O_CREAT | (truncate ? O_TRUNC : 0), 0644 );
+	offset = 0;
+	return fd >= 0;
+}
+
+/********************************************************************************
+*	Function: flushBatch()
+*	Description: Writes the batch at the end of the file with pwrite, retrying
+*		short and interrupted writes
+*	Parameters: None
+*	Pre-Conditions: None
+*	Post-Conditions: The batch is empty. A failed write marks the writer failed.
+* ******************************************************************************/
+void FrameWriter::flushBatch()
+{
+	size_t done = 0;
+	bool ok = fd >= 0 || batch.empty();
+
+	while( ok && done < batch.size() )
+	{
+		ssize_t n = pwrite( fd, &batch[done], batch.size() - done, offset + done );
+		if( n < 0 && errno == EINTR )
+			continue;
+		if( n <= 0 )
+			ok = false;
+		else
+			done += n;
+	}
+
+	offset += done;
+	batch.clear();
+
+	std::lock_guard<std::mutex> hold( lock );
+	bytes += done;
+	if( !ok )
+		failed = true;
+}
+
+/********************************************************************************
+*	Function: closeFile()
+*	Description: Closes the file being written
+*	Parameters: None
+*	Pre-Conditions: The batch has been written
+*	Post-Conditions: fd is -1
+* ******************************************************************************/
+void FrameWriter::closeFile()
+{
+	if( fd >= 0 )
+		close( fd );
+	fd = -1;
+}
+
+/********************************************************************************
+*	Function: setRule( const std::string & )
+*	Description: Sets the rule written in the header of RLE files
+*	Parameters: The rule, "B3/S23" by default
+*	Pre-Conditions: None
+*	Post-Conditions: Frames encoded from now on carry the rule
+* ******************************************************************************/
+void FrameWriter::setRule( const std::string &text )
+{
+	flush();
+	rule = text;
+}
+
+/********************************************************************************
+*	Function: framePath( const std::string &, int, long long )
+*	Description: Returns the name of the file a frame is written to
+*	Parameters: The file name prefix, the format, and the generation
+*	Pre-Conditions: None
+*	Post-Conditions: returns the file name
+* ******************************************************************************/
+std::string FrameWriter::framePath( const std::string &prefix, int format, long long generation )
+{
+	char name[32];
+
+	if( format == FRAME_BINARY )
+		return prefix + ".frames";
+	snprintf( name, sizeof(name), ".%06lld%s", generation,
+			format == FRAME_PGM ? ".pgm" : ".rle" );
+	return prefix + name;
+}
+
+/********************************************************************************
+*	Function: getFrames(), getBytes(), getStalls(), getStallSeconds(),
+*		getWriteSeconds(), getMaxQueued(), good()
+*	Description: Statistics: frames and bytes written, how often and how long
+*		submit() waited for a slot, the writer's busy time, the most snapshots
+*		waiting at once, and whether every write so far succeeded
+*	Parameters: None
+*	Pre-Conditions: Call flush() first for totals that cover every submit
+*	Post-Conditions: returns the statistic
+* ******************************************************************************/
+long long FrameWriter::getFrames()
+{
+	std::lock_guard<std::mutex> hold( lock );
+	return frames;
+}
+
+long long FrameWriter::getBytes()
+{
+	std::lock_guard<std::mutex> hold( lock );
+	return bytes;
+}
+
+long long FrameWriter::getStalls()
+{
+	std::lock_guard<std::mutex> hold( lock );
+	return stalls;
+}
+
+double FrameWriter::getStallSeconds()
+{
+	std::lock_guard<std::mutex> hold( lock );
+	return stallSeconds;
+}
+
+double FrameWriter::getWriteSeconds()
+{
+	std::lock_guard<std::mutex> hold( lock );
+	return writeSeconds;
+}
+
+long long FrameWriter::getMaxQueued()
+{
+	std::lock_guard<std::mutex> hold( lock );
+	return maxQueued;
+}
+
+bool FrameWriter::good()
+{
+	std::lock_guard<std::mutex> hold( lock );
+	return !failed;
+}
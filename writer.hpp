@@ -0,0 +1,176 @@
+/******************************************************************************
+ ** Program Filename: writer.hpp
+ ** Author: Wesley Jinks
+ ** Date: 10/19/2026
+ ** Description: This is the header file for the FrameWriter class. A
+			FrameWriter takes snapshots of a Grid from the stepping thread and
+			writes them to disk on a background thread, so encoding and I/O
+			overlap the stepping instead of adding to it. Snapshots are copied
+			into a ring of preallocated bit-packed slots; the writer encodes
+			each one as an RLE pattern, a raw binary frame, or a PGM image,
+			and writes through a batch buffer with pwrite. When every slot is
+			waiting to be written, submit() blocks until one is free, so a
+			slow disk slows the stepper down rather than growing memory. With
+			no slots, frames are written inline by submit().
+
+			File layout. FRAME_RLE and FRAME_PGM write one file per frame,
+			named <prefix>.<generation><extension>. FRAME_BINARY appends every
+			frame to <prefix>.frames, each one a header of the 4 bytes "GOLF",
+			the generation as a 64 bit integer and the rows and columns as 32
+			bit integers, followed by the packed rows as in a Grid, all in the
+			machine's byte order.
+ ** Input: Snapshots of a Grid
+ ** Output: RLE, binary frame, or PGM files
+ * ***************************************************************************/
+#ifndef WRITER_HPP
+#define WRITER_HPP
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "grid.hpp"
+
+#define FRAME_RLE 0		//Run length encoded pattern, one .rle file per frame
+#define FRAME_BINARY 1	//Packed frames appended to one .frames file
+#define FRAME_PGM 2		//Binary greyscale image, one .pgm file per frame
+
+#define FRAME_SLOTS 8				//Default snapshots waiting to be written
+#define FRAME_BATCH (1 << 20)		//Default bytes gathered before each pwrite
+#define FRAME_RLE_LINE 70			//Longest line of an RLE file
+
+//FrameWriter Class Declaration
+class FrameWriter
+{
+	private:
+		std::string prefix;	//Start of every file name
+		int format;			//FRAME_RLE, FRAME_BINARY or FRAME_PGM
+		std::string rule;	//Rule written in RLE headers
+		std::vector<Grid> slots;			//Ring of snapshots
+		std::vector<long long> slotGeneration; //Generation held in each slot
+		long long head;		//Snapshots submitted
+		long long tail;		//Snapshots written
+		bool drained;		//The writer is idle with nothing left in the batch
+		bool stopping;		//The writer should finish and leave
+		bool failed;		//A file could not be opened or written
+		std::mutex lock;	//Guards head, tail, drained, stopping, failed and stats
+		std::condition_variable ready;	//Signals the writer a snapshot or stop
+		std::condition_variable space;	//Signals a slot freed or the writer drained
+		std::thread writer;	//The background writer, if there are slots
+		int fd;				//File being written, -1 if none
+		long long offset;	//Offset in the file of the start of the batch
+		std::vector<char> batch;	//Bytes waiting for the next pwrite
+		size_t batchBytes;	//Size of batch that triggers a pwrite
+		std::vector<uint64_t> expand; //Eight PGM pixels for each byte of cells
+		std::vector<unsigned char> pixels; //One row of a PGM image
+		int lineLength;		//Characters on the current RLE line
+		long long frames;	//Frames written
+		long long bytes;	//Bytes written
+		long long stalls;	//Times submit() waited for a free slot
+		double stallSeconds;	//Time submit() spent waiting
+		double writeSeconds;	//Time the writer spent encoding and writing
+		long long maxQueued;	//Most snapshots waiting at once
+
+		FrameWriter( const FrameWriter & );
+		FrameWriter &operator=( const FrameWriter & );
+
+		void work();
+		void writeFrame( const Grid &, long long );
+		void encodeRle( const Grid &, long long );
+		void encodeBinary( const Grid &, long long );
+		void encodePgm( const Grid & );
+		void rleToken( long long, char );
+		void put( const void *, size_t );
+		bool openFile( const std::string &, bool );
+		void flushBatch();
+		void closeFile();
+
+	public:
+		/********************************************************************************
+		*	Function: FrameWriter( const std::string &, int, int, size_t )
+		*	Description: Constructor of a writer. The background thread is started when
+		*		there are slots.
+		*	Parameters: The file name prefix, the format, the number of slots (0 to
+		*		write inline), and the bytes gathered before each pwrite
+		*	Pre-Conditions: None
+		*	Post-Conditions: The writer is ready for snapshots. A FRAME_BINARY file is
+		*		created empty.
+		* ******************************************************************************/
+		FrameWriter( const std::string &, int = FRAME_RLE, int = FRAME_SLOTS,
+				size_t = FRAME_BATCH );
+
+		/********************************************************************************
+		*	Function: ~FrameWriter()
+		*	Description: Destructor, writes every snapshot still waiting and stops the
+		*		writer
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: Every submitted frame is on disk and the file is closed
+		* ******************************************************************************/
+		~FrameWriter();
+
+		/********************************************************************************
+		*	Function: submit( const Grid &, long long )
+		*	Description: Hands a snapshot of a board to the writer. The board is copied,
+		*		so the caller may step it as soon as this returns. Blocks while every
+		*		slot is waiting to be written. Only one thread may submit.
+		*	Parameters: The board and its generation
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false if the writer has failed, and the snapshot is
+		*		then dropped
+		* ******************************************************************************/
+		bool submit( const Grid &, long long );
+
+		/********************************************************************************
+		*	Function: flush()
+		*	Description: Waits until every submitted snapshot is written to disk
+		*	Parameters: None
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns false if the writer has failed
+		* ******************************************************************************/
+		bool flush();
+
+		/********************************************************************************
+		*	Function: setRule( const std::string & )
+		*	Description: Sets the rule written in the header of RLE files
+		*	Parameters: The rule, "B3/S23" by default
+		*	Pre-Conditions: None
+		*	Post-Conditions: Frames encoded from now on carry the rule
+		* ******************************************************************************/
+		void setRule( const std::string & );
+
+		/********************************************************************************
+		*	Function: framePath( const std::string &, int, long long )
+		*	Description: Returns the name of the file a frame is written to
+		*	Parameters: The file name prefix, the format, and the generation
+		*	Pre-Conditions: None
+		*	Post-Conditions: returns the file name
+		* ******************************************************************************/
+		static std::string framePath( const std::string &, int, long long );
+
+		/********************************************************************************
+		*	Function: getFrames(), getBytes(), getStalls(), getStallSeconds(),
+		*		getWriteSeconds(), getMaxQueued(), good()
+		*	Description: Statistics: frames and bytes written, how often and how long
+		*		submit() waited for a slot, the writer's busy time, the most snapshots
+		*		waiting at once, and whether every write so far succeeded
+		*	Parameters: None
+		*	Pre-Conditions: Call flush() first for totals that cover every submit
+		*	Post-Conditions: returns the statistic
+		* ******************************************************************************/
+		long long getFrames();
+		long long getBytes();
+		long long getStalls();
+		double getStallSeconds();
+		double getWriteSeconds();
+		long long getMaxQueued();
+		bool good();
+
+		int getSlots() const
+		{ return (int)slots.size(); }
+
+		int getFormat() const
+		{ return format; }
+};
+
+#endif